@@ -0,0 +1,78 @@
+// bench.h
+// vim9-bench 各模式共用的小工具：语料加载、计时、分位数、峰值内存。
+
+#ifndef VIM9_BENCH_H_
+#define VIM9_BENCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9.h>
+
+typedef struct {
+    char *path;
+    char *data;
+    uint32_t length;
+} BenchFile;
+
+typedef struct {
+    BenchFile *files;
+    size_t count;
+    size_t capacity;
+    uint64_t total_bytes;
+} BenchCorpus;
+
+typedef struct {
+    unsigned iterations;
+    unsigned warmup;
+    bool json;
+    bool edit;
+    bool arena;
+    const char *profile;  // --profile 的输出文件，NULL 表示不统计
+    const char **queries;  // --query 的 .scm 文件，非空时跑查询模式
+    size_t query_count;
+    uint32_t match_limit;
+    bool stream;
+    unsigned stream_mb;  // --stream 拼出的文件大小
+    unsigned chunk_kb;
+    unsigned threads;
+} BenchOptions;
+
+// --profile：按 parse state 计 shift/reduce，下标 state_count 收容日志里越界的 state
+typedef struct {
+    const TSLanguage *language;
+    uint32_t state_count;
+    uint32_t symbol_count;
+    uint32_t state;  // 当前这一步的 state
+    uint64_t *steps;
+    uint64_t *shifts;
+    uint64_t *reduces;
+    uint64_t *reduced;  // 按 symbol 计的 reduce
+} BenchProfile;
+
+// 逐个加载文件；目录按文件名排序，只取 *.vim
+bool bench_corpus_add(BenchCorpus *corpus, const char *path);
+void bench_corpus_free(BenchCorpus *corpus);
+
+uint64_t bench_now_ns(void);
+double bench_percentile(uint64_t *samples, size_t count, double p);
+uint64_t bench_peak_rss_bytes(void);
+
+TSParser *bench_parser_new(void);
+
+bool bench_profile_init(BenchProfile *profile, const TSLanguage *language);
+void bench_profile_free(BenchProfile *profile);
+void bench_profile_log(BenchProfile *profile, const char *message);
+bool bench_profile_write(const BenchProfile *profile, const char *path);
+
+int bench_parse(const BenchCorpus *corpus, const BenchOptions *options);
+int bench_query(const BenchCorpus *corpus, const BenchOptions *options);
+// 语料可以为空，此时用合成的生成文件
+int bench_stream(const BenchCorpus *corpus, const BenchOptions *options);
+
+// 不读语料，使用内部合成的长 def
+int bench_edit(const BenchOptions *options);
+
+#endif // VIM9_BENCH_H_
@@ -0,0 +1,281 @@
+vim9script
+
+# 回调密集：嵌套 (a) => { ... } 与 dict 字面量
+
+var log_lines = []
+var handlers = {}
+
+def Log(msg: string)
+  log_lines->add(msg)
+enddef
+
+def Watch0(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(100, (id) => {
+    Log('watch0 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch0'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch0 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch0 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch1(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(110, (id) => {
+    Log('watch1 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch1'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch1 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch1 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch2(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(120, (id) => {
+    Log('watch2 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch2'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch2 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch2 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch3(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(130, (id) => {
+    Log('watch3 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch3'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch3 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch3 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch4(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(140, (id) => {
+    Log('watch4 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch4'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch4 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch4 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch5(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(150, (id) => {
+    Log('watch5 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch5'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch5 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch5 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch6(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(160, (id) => {
+    Log('watch6 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch6'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch6 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch6 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch7(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(170, (id) => {
+    Log('watch7 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch7'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch7 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch7 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch8(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(180, (id) => {
+    Log('watch8 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch8'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch8 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch8 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch9(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(190, (id) => {
+    Log('watch9 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch9'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch9 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch9 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch10(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(200, (id) => {
+    Log('watch10 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch10'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch10 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch10 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+def Watch11(items: list<any>, limit: number): list<any>
+  var seen = {}
+  var picked = filter(copy(items), (_, item) => item['size'] < limit && !has_key(seen, item['name']))
+  var names = map(picked, (_, item) => {
+    seen[item['name']] = true
+    return item['name'] .. ':' .. string(item['size'])
+  })
+  timer_start(210, (id) => {
+    Log('watch11 tick ' .. string(id))
+    var again = map(copy(names), (_, n) => {
+      var parts = split(n, ':')
+      return {name: parts[0], size: str2nr(parts[1]), done: (ok) => ok ? 'ok' : 'fail'}
+    })
+    handlers['watch11'] = {items: again, count: len(again), on_done: (r) => Log(r)}
+  })
+  job_start(['ls', '-l'], {out_cb: (ch, msg) => {
+      Log('watch11 out ' .. msg)
+    }, exit_cb: (job, status) => Log('watch11 exit ' .. string(status))})
+  sort(names, (a, b) => a < b ? -1 : a > b ? 1 : 0)
+  return names
+enddef
+
+var F = (a, b) => a + b
+var G = () => {
+  Log('empty args')
+}
+var cfg = {on_start: () => Log('start'), on_stop: (code) => Log('stop ' .. string(code))}
+Watch0([{name: 'a', size: 1}, {name: 'b', size: 2}], 10)
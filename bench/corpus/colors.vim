@@ -0,0 +1,238 @@
+vim9script
+
+# colorscheme 导出：大量 highlight 行
+
+highlight clear
+if exists('syntax_on')
+  syntax reset
+endif
+
+g:colors_name = 'bench'
+set background=dark
+
+if &background == 'dark'
+  highlight Normal guifg=#1d2021 guibg=#83a598 gui=NONE ctermfg=234 ctermbg=109 cterm=NONE
+  highlight Comment guifg=#8ec07c guibg=#fe8019 gui=bold ctermfg=108 ctermbg=208 cterm=bold
+  highlight Constant guifg=#fb4934 guibg=#504945 gui=italic ctermfg=167 ctermbg=239 cterm=italic
+  highlight String guifg=#928374 guibg=#fb4934 gui=underline ctermfg=245 ctermbg=167 cterm=underline
+  highlight Character guifg=#fabd2f guibg=#83a598 gui=reverse ctermfg=214 ctermbg=109 cterm=reverse
+  highlight Number guifg=#504945 guibg=#fe8019 gui=undercurl ctermfg=239 ctermbg=208 cterm=undercurl
+  highlight Boolean guifg=#d3869b guibg=#504945 gui=bold,italic ctermfg=175 ctermbg=239 cterm=bold,italic
+  highlight Float guifg=#ebdbb2 guibg=#fb4934 gui=NONE ctermfg=223 ctermbg=167 cterm=NONE
+  highlight Identifier guifg=#fe8019 guibg=#83a598 gui=bold ctermfg=208 ctermbg=109 cterm=bold
+  highlight Function guifg=#b8bb26 guibg=#fe8019 gui=italic ctermfg=142 ctermbg=208 cterm=italic
+  highlight Statement guifg=#3c3836 guibg=#504945 gui=underline ctermfg=237 ctermbg=239 cterm=underline
+  highlight Conditional guifg=#83a598 guibg=#fb4934 gui=reverse ctermfg=109 ctermbg=167 cterm=reverse
+  highlight Repeat guifg=#1d2021 guibg=#83a598 gui=undercurl ctermfg=234 ctermbg=109 cterm=undercurl
+  highlight Label guifg=#8ec07c guibg=#fe8019 gui=bold,italic ctermfg=108 ctermbg=208 cterm=bold,italic
+  highlight Operator guifg=#fb4934 guibg=#504945 gui=NONE ctermfg=167 ctermbg=239 cterm=NONE
+  highlight Keyword guifg=#928374 guibg=#fb4934 gui=bold ctermfg=245 ctermbg=167 cterm=bold
+  highlight Exception guifg=#fabd2f guibg=#83a598 gui=italic ctermfg=214 ctermbg=109 cterm=italic
+  highlight PreProc guifg=#504945 guibg=#fe8019 gui=underline ctermfg=239 ctermbg=208 cterm=underline
+  highlight Include guifg=#d3869b guibg=#504945 gui=reverse ctermfg=175 ctermbg=239 cterm=reverse
+  highlight Define guifg=#ebdbb2 guibg=#fb4934 gui=undercurl ctermfg=223 ctermbg=167 cterm=undercurl
+  highlight Macro guifg=#fe8019 guibg=#83a598 gui=bold,italic ctermfg=208 ctermbg=109 cterm=bold,italic
+  highlight PreCondit guifg=#b8bb26 guibg=#fe8019 gui=NONE ctermfg=142 ctermbg=208 cterm=NONE
+  highlight Type guifg=#3c3836 guibg=#504945 gui=bold ctermfg=237 ctermbg=239 cterm=bold
+  highlight StorageClass guifg=#83a598 guibg=#fb4934 gui=italic ctermfg=109 ctermbg=167 cterm=italic
+  highlight Structure guifg=#1d2021 guibg=#83a598 gui=underline ctermfg=234 ctermbg=109 cterm=underline
+  highlight Typedef guifg=#8ec07c guibg=#fe8019 gui=reverse ctermfg=108 ctermbg=208 cterm=reverse
+  highlight Special guifg=#fb4934 guibg=#504945 gui=undercurl ctermfg=167 ctermbg=239 cterm=undercurl
+  highlight SpecialChar guifg=#928374 guibg=#fb4934 gui=bold,italic ctermfg=245 ctermbg=167 cterm=bold,italic
+  highlight Tag guifg=#fabd2f guibg=#83a598 gui=NONE ctermfg=214 ctermbg=109 cterm=NONE
+  highlight Delimiter guifg=#504945 guibg=#fe8019 gui=bold ctermfg=239 ctermbg=208 cterm=bold
+  highlight SpecialComment guifg=#d3869b guibg=#504945 gui=italic ctermfg=175 ctermbg=239 cterm=italic
+  highlight Debug guifg=#ebdbb2 guibg=#fb4934 gui=underline ctermfg=223 ctermbg=167 cterm=underline
+  highlight Underlined guifg=#fe8019 guibg=#83a598 gui=reverse ctermfg=208 ctermbg=109 cterm=reverse
+  highlight Ignore guifg=#b8bb26 guibg=#fe8019 gui=undercurl ctermfg=142 ctermbg=208 cterm=undercurl
+  highlight Error guifg=#3c3836 guibg=#504945 gui=bold,italic ctermfg=237 ctermbg=239 cterm=bold,italic
+  highlight Todo guifg=#83a598 guibg=#fb4934 gui=NONE ctermfg=109 ctermbg=167 cterm=NONE
+  highlight ColorColumn guifg=#1d2021 guibg=#83a598 gui=bold ctermfg=234 ctermbg=109 cterm=bold
+  highlight Conceal guifg=#8ec07c guibg=#fe8019 gui=italic ctermfg=108 ctermbg=208 cterm=italic
+  highlight Cursor guifg=#fb4934 guibg=#504945 gui=underline ctermfg=167 ctermbg=239 cterm=underline
+  highlight CursorColumn guifg=#928374 guibg=#fb4934 gui=reverse ctermfg=245 ctermbg=167 cterm=reverse
+  highlight CursorLine guifg=#fabd2f guibg=#83a598 gui=undercurl ctermfg=214 ctermbg=109 cterm=undercurl
+  highlight Directory guifg=#504945 guibg=#fe8019 gui=bold,italic ctermfg=239 ctermbg=208 cterm=bold,italic
+  highlight DiffAdd guifg=#d3869b guibg=#504945 gui=NONE ctermfg=175 ctermbg=239 cterm=NONE
+  highlight DiffChange guifg=#ebdbb2 guibg=#fb4934 gui=bold ctermfg=223 ctermbg=167 cterm=bold
+  highlight DiffDelete guifg=#fe8019 guibg=#83a598 gui=italic ctermfg=208 ctermbg=109 cterm=italic
+  highlight DiffText guifg=#b8bb26 guibg=#fe8019 gui=underline ctermfg=142 ctermbg=208 cterm=underline
+  highlight EndOfBuffer guifg=#3c3836 guibg=#504945 gui=reverse ctermfg=237 ctermbg=239 cterm=reverse
+  highlight ErrorMsg guifg=#83a598 guibg=#fb4934 gui=undercurl ctermfg=109 ctermbg=167 cterm=undercurl
+  highlight VertSplit guifg=#1d2021 guibg=#83a598 gui=bold,italic ctermfg=234 ctermbg=109 cterm=bold,italic
+  highlight Folded guifg=#8ec07c guibg=#fe8019 gui=NONE ctermfg=108 ctermbg=208 cterm=NONE
+  highlight FoldColumn guifg=#fb4934 guibg=#504945 gui=bold ctermfg=167 ctermbg=239 cterm=bold
+  highlight SignColumn guifg=#928374 guibg=#fb4934 gui=italic ctermfg=245 ctermbg=167 cterm=italic
+  highlight IncSearch guifg=#fabd2f guibg=#83a598 gui=underline ctermfg=214 ctermbg=109 cterm=underline
+  highlight LineNr guifg=#504945 guibg=#fe8019 gui=reverse ctermfg=239 ctermbg=208 cterm=reverse
+  highlight CursorLineNr guifg=#d3869b guibg=#504945 gui=undercurl ctermfg=175 ctermbg=239 cterm=undercurl
+  highlight MatchParen guifg=#ebdbb2 guibg=#fb4934 gui=bold,italic ctermfg=223 ctermbg=167 cterm=bold,italic
+  highlight ModeMsg guifg=#fe8019 guibg=#83a598 gui=NONE ctermfg=208 ctermbg=109 cterm=NONE
+  highlight MoreMsg guifg=#b8bb26 guibg=#fe8019 gui=bold ctermfg=142 ctermbg=208 cterm=bold
+  highlight NonText guifg=#3c3836 guibg=#504945 gui=italic ctermfg=237 ctermbg=239 cterm=italic
+  highlight Pmenu guifg=#83a598 guibg=#fb4934 gui=underline ctermfg=109 ctermbg=167 cterm=underline
+  highlight PmenuSel guifg=#1d2021 guibg=#83a598 gui=reverse ctermfg=234 ctermbg=109 cterm=reverse
+  highlight PmenuSbar guifg=#8ec07c guibg=#fe8019 gui=undercurl ctermfg=108 ctermbg=208 cterm=undercurl
+  highlight PmenuThumb guifg=#fb4934 guibg=#504945 gui=bold,italic ctermfg=167 ctermbg=239 cterm=bold,italic
+  highlight Question guifg=#928374 guibg=#fb4934 gui=NONE ctermfg=245 ctermbg=167 cterm=NONE
+  highlight QuickFixLine guifg=#fabd2f guibg=#83a598 gui=bold ctermfg=214 ctermbg=109 cterm=bold
+  highlight Search guifg=#504945 guibg=#fe8019 gui=italic ctermfg=239 ctermbg=208 cterm=italic
+  highlight SpecialKey guifg=#d3869b guibg=#504945 gui=underline ctermfg=175 ctermbg=239 cterm=underline
+  highlight SpellBad guifg=#ebdbb2 guibg=#fb4934 gui=reverse ctermfg=223 ctermbg=167 cterm=reverse
+  highlight SpellCap guifg=#fe8019 guibg=#83a598 gui=undercurl ctermfg=208 ctermbg=109 cterm=undercurl
+  highlight SpellLocal guifg=#b8bb26 guibg=#fe8019 gui=bold,italic ctermfg=142 ctermbg=208 cterm=bold,italic
+  highlight SpellRare guifg=#3c3836 guibg=#504945 gui=NONE ctermfg=237 ctermbg=239 cterm=NONE
+  highlight StatusLine guifg=#83a598 guibg=#fb4934 gui=bold ctermfg=109 ctermbg=167 cterm=bold
+  highlight StatusLineNC guifg=#1d2021 guibg=#83a598 gui=italic ctermfg=234 ctermbg=109 cterm=italic
+  highlight StatusLineTerm guifg=#8ec07c guibg=#fe8019 gui=underline ctermfg=108 ctermbg=208 cterm=underline
+  highlight StatusLineTermNC guifg=#fb4934 guibg=#504945 gui=reverse ctermfg=167 ctermbg=239 cterm=reverse
+  highlight TabLine guifg=#928374 guibg=#fb4934 gui=undercurl ctermfg=245 ctermbg=167 cterm=undercurl
+  highlight TabLineFill guifg=#fabd2f guibg=#83a598 gui=bold,italic ctermfg=214 ctermbg=109 cterm=bold,italic
+  highlight TabLineSel guifg=#504945 guibg=#fe8019 gui=NONE ctermfg=239 ctermbg=208 cterm=NONE
+  highlight Terminal guifg=#d3869b guibg=#504945 gui=bold ctermfg=175 ctermbg=239 cterm=bold
+  highlight Title guifg=#ebdbb2 guibg=#fb4934 gui=italic ctermfg=223 ctermbg=167 cterm=italic
+  highlight Visual guifg=#fe8019 guibg=#83a598 gui=underline ctermfg=208 ctermbg=109 cterm=underline
+  highlight VisualNOS guifg=#b8bb26 guibg=#fe8019 gui=reverse ctermfg=142 ctermbg=208 cterm=reverse
+  highlight WarningMsg guifg=#3c3836 guibg=#504945 gui=undercurl ctermfg=237 ctermbg=239 cterm=undercurl
+  highlight WildMenu guifg=#83a598 guibg=#fb4934 gui=bold,italic ctermfg=109 ctermbg=167 cterm=bold,italic
+endif
+
+if &background == 'light'
+  highlight Normal guifg=#1d2021 guibg=#83a598 gui=NONE ctermfg=234 ctermbg=109 cterm=NONE
+  highlight Comment guifg=#8ec07c guibg=#fe8019 gui=bold ctermfg=108 ctermbg=208 cterm=bold
+  highlight Constant guifg=#fb4934 guibg=#504945 gui=italic ctermfg=167 ctermbg=239 cterm=italic
+  highlight String guifg=#928374 guibg=#fb4934 gui=underline ctermfg=245 ctermbg=167 cterm=underline
+  highlight Character guifg=#fabd2f guibg=#83a598 gui=reverse ctermfg=214 ctermbg=109 cterm=reverse
+  highlight Number guifg=#504945 guibg=#fe8019 gui=undercurl ctermfg=239 ctermbg=208 cterm=undercurl
+  highlight Boolean guifg=#d3869b guibg=#504945 gui=bold,italic ctermfg=175 ctermbg=239 cterm=bold,italic
+  highlight Float guifg=#ebdbb2 guibg=#fb4934 gui=NONE ctermfg=223 ctermbg=167 cterm=NONE
+  highlight Identifier guifg=#fe8019 guibg=#83a598 gui=bold ctermfg=208 ctermbg=109 cterm=bold
+  highlight Function guifg=#b8bb26 guibg=#fe8019 gui=italic ctermfg=142 ctermbg=208 cterm=italic
+  highlight Statement guifg=#3c3836 guibg=#504945 gui=underline ctermfg=237 ctermbg=239 cterm=underline
+  highlight Conditional guifg=#83a598 guibg=#fb4934 gui=reverse ctermfg=109 ctermbg=167 cterm=reverse
+  highlight Repeat guifg=#1d2021 guibg=#83a598 gui=undercurl ctermfg=234 ctermbg=109 cterm=undercurl
+  highlight Label guifg=#8ec07c guibg=#fe8019 gui=bold,italic ctermfg=108 ctermbg=208 cterm=bold,italic
+  highlight Operator guifg=#fb4934 guibg=#504945 gui=NONE ctermfg=167 ctermbg=239 cterm=NONE
+  highlight Keyword guifg=#928374 guibg=#fb4934 gui=bold ctermfg=245 ctermbg=167 cterm=bold
+  highlight Exception guifg=#fabd2f guibg=#83a598 gui=italic ctermfg=214 ctermbg=109 cterm=italic
+  highlight PreProc guifg=#504945 guibg=#fe8019 gui=underline ctermfg=239 ctermbg=208 cterm=underline
+  highlight Include guifg=#d3869b guibg=#504945 gui=reverse ctermfg=175 ctermbg=239 cterm=reverse
+  highlight Define guifg=#ebdbb2 guibg=#fb4934 gui=undercurl ctermfg=223 ctermbg=167 cterm=undercurl
+  highlight Macro guifg=#fe8019 guibg=#83a598 gui=bold,italic ctermfg=208 ctermbg=109 cterm=bold,italic
+  highlight PreCondit guifg=#b8bb26 guibg=#fe8019 gui=NONE ctermfg=142 ctermbg=208 cterm=NONE
+  highlight Type guifg=#3c3836 guibg=#504945 gui=bold ctermfg=237 ctermbg=239 cterm=bold
+  highlight StorageClass guifg=#83a598 guibg=#fb4934 gui=italic ctermfg=109 ctermbg=167 cterm=italic
+  highlight Structure guifg=#1d2021 guibg=#83a598 gui=underline ctermfg=234 ctermbg=109 cterm=underline
+  highlight Typedef guifg=#8ec07c guibg=#fe8019 gui=reverse ctermfg=108 ctermbg=208 cterm=reverse
+  highlight Special guifg=#fb4934 guibg=#504945 gui=undercurl ctermfg=167 ctermbg=239 cterm=undercurl
+  highlight SpecialChar guifg=#928374 guibg=#fb4934 gui=bold,italic ctermfg=245 ctermbg=167 cterm=bold,italic
+  highlight Tag guifg=#fabd2f guibg=#83a598 gui=NONE ctermfg=214 ctermbg=109 cterm=NONE
+  highlight Delimiter guifg=#504945 guibg=#fe8019 gui=bold ctermfg=239 ctermbg=208 cterm=bold
+  highlight SpecialComment guifg=#d3869b guibg=#504945 gui=italic ctermfg=175 ctermbg=239 cterm=italic
+  highlight Debug guifg=#ebdbb2 guibg=#fb4934 gui=underline ctermfg=223 ctermbg=167 cterm=underline
+  highlight Underlined guifg=#fe8019 guibg=#83a598 gui=reverse ctermfg=208 ctermbg=109 cterm=reverse
+  highlight Ignore guifg=#b8bb26 guibg=#fe8019 gui=undercurl ctermfg=142 ctermbg=208 cterm=undercurl
+  highlight Error guifg=#3c3836 guibg=#504945 gui=bold,italic ctermfg=237 ctermbg=239 cterm=bold,italic
+  highlight Todo guifg=#83a598 guibg=#fb4934 gui=NONE ctermfg=109 ctermbg=167 cterm=NONE
+  highlight ColorColumn guifg=#1d2021 guibg=#83a598 gui=bold ctermfg=234 ctermbg=109 cterm=bold
+  highlight Conceal guifg=#8ec07c guibg=#fe8019 gui=italic ctermfg=108 ctermbg=208 cterm=italic
+  highlight Cursor guifg=#fb4934 guibg=#504945 gui=underline ctermfg=167 ctermbg=239 cterm=underline
+  highlight CursorColumn guifg=#928374 guibg=#fb4934 gui=reverse ctermfg=245 ctermbg=167 cterm=reverse
+  highlight CursorLine guifg=#fabd2f guibg=#83a598 gui=undercurl ctermfg=214 ctermbg=109 cterm=undercurl
+  highlight Directory guifg=#504945 guibg=#fe8019 gui=bold,italic ctermfg=239 ctermbg=208 cterm=bold,italic
+  highlight DiffAdd guifg=#d3869b guibg=#504945 gui=NONE ctermfg=175 ctermbg=239 cterm=NONE
+  highlight DiffChange guifg=#ebdbb2 guibg=#fb4934 gui=bold ctermfg=223 ctermbg=167 cterm=bold
+  highlight DiffDelete guifg=#fe8019 guibg=#83a598 gui=italic ctermfg=208 ctermbg=109 cterm=italic
+  highlight DiffText guifg=#b8bb26 guibg=#fe8019 gui=underline ctermfg=142 ctermbg=208 cterm=underline
+  highlight EndOfBuffer guifg=#3c3836 guibg=#504945 gui=reverse ctermfg=237 ctermbg=239 cterm=reverse
+  highlight ErrorMsg guifg=#83a598 guibg=#fb4934 gui=undercurl ctermfg=109 ctermbg=167 cterm=undercurl
+  highlight VertSplit guifg=#1d2021 guibg=#83a598 gui=bold,italic ctermfg=234 ctermbg=109 cterm=bold,italic
+  highlight Folded guifg=#8ec07c guibg=#fe8019 gui=NONE ctermfg=108 ctermbg=208 cterm=NONE
+  highlight FoldColumn guifg=#fb4934 guibg=#504945 gui=bold ctermfg=167 ctermbg=239 cterm=bold
+  highlight SignColumn guifg=#928374 guibg=#fb4934 gui=italic ctermfg=245 ctermbg=167 cterm=italic
+  highlight IncSearch guifg=#fabd2f guibg=#83a598 gui=underline ctermfg=214 ctermbg=109 cterm=underline
+  highlight LineNr guifg=#504945 guibg=#fe8019 gui=reverse ctermfg=239 ctermbg=208 cterm=reverse
+  highlight CursorLineNr guifg=#d3869b guibg=#504945 gui=undercurl ctermfg=175 ctermbg=239 cterm=undercurl
+  highlight MatchParen guifg=#ebdbb2 guibg=#fb4934 gui=bold,italic ctermfg=223 ctermbg=167 cterm=bold,italic
+  highlight ModeMsg guifg=#fe8019 guibg=#83a598 gui=NONE ctermfg=208 ctermbg=109 cterm=NONE
+  highlight MoreMsg guifg=#b8bb26 guibg=#fe8019 gui=bold ctermfg=142 ctermbg=208 cterm=bold
+  highlight NonText guifg=#3c3836 guibg=#504945 gui=italic ctermfg=237 ctermbg=239 cterm=italic
+  highlight Pmenu guifg=#83a598 guibg=#fb4934 gui=underline ctermfg=109 ctermbg=167 cterm=underline
+  highlight PmenuSel guifg=#1d2021 guibg=#83a598 gui=reverse ctermfg=234 ctermbg=109 cterm=reverse
+  highlight PmenuSbar guifg=#8ec07c guibg=#fe8019 gui=undercurl ctermfg=108 ctermbg=208 cterm=undercurl
+  highlight PmenuThumb guifg=#fb4934 guibg=#504945 gui=bold,italic ctermfg=167 ctermbg=239 cterm=bold,italic
+  highlight Question guifg=#928374 guibg=#fb4934 gui=NONE ctermfg=245 ctermbg=167 cterm=NONE
+  highlight QuickFixLine guifg=#fabd2f guibg=#83a598 gui=bold ctermfg=214 ctermbg=109 cterm=bold
+  highlight Search guifg=#504945 guibg=#fe8019 gui=italic ctermfg=239 ctermbg=208 cterm=italic
+  highlight SpecialKey guifg=#d3869b guibg=#504945 gui=underline ctermfg=175 ctermbg=239 cterm=underline
+  highlight SpellBad guifg=#ebdbb2 guibg=#fb4934 gui=reverse ctermfg=223 ctermbg=167 cterm=reverse
+  highlight SpellCap guifg=#fe8019 guibg=#83a598 gui=undercurl ctermfg=208 ctermbg=109 cterm=undercurl
+  highlight SpellLocal guifg=#b8bb26 guibg=#fe8019 gui=bold,italic ctermfg=142 ctermbg=208 cterm=bold,italic
+  highlight SpellRare guifg=#3c3836 guibg=#504945 gui=NONE ctermfg=237 ctermbg=239 cterm=NONE
+  highlight StatusLine guifg=#83a598 guibg=#fb4934 gui=bold ctermfg=109 ctermbg=167 cterm=bold
+  highlight StatusLineNC guifg=#1d2021 guibg=#83a598 gui=italic ctermfg=234 ctermbg=109 cterm=italic
+  highlight StatusLineTerm guifg=#8ec07c guibg=#fe8019 gui=underline ctermfg=108 ctermbg=208 cterm=underline
+  highlight StatusLineTermNC guifg=#fb4934 guibg=#504945 gui=reverse ctermfg=167 ctermbg=239 cterm=reverse
+  highlight TabLine guifg=#928374 guibg=#fb4934 gui=undercurl ctermfg=245 ctermbg=167 cterm=undercurl
+  highlight TabLineFill guifg=#fabd2f guibg=#83a598 gui=bold,italic ctermfg=214 ctermbg=109 cterm=bold,italic
+  highlight TabLineSel guifg=#504945 guibg=#fe8019 gui=NONE ctermfg=239 ctermbg=208 cterm=NONE
+  highlight Terminal guifg=#d3869b guibg=#504945 gui=bold ctermfg=175 ctermbg=239 cterm=bold
+  highlight Title guifg=#ebdbb2 guibg=#fb4934 gui=italic ctermfg=223 ctermbg=167 cterm=italic
+  highlight Visual guifg=#fe8019 guibg=#83a598 gui=underline ctermfg=208 ctermbg=109 cterm=underline
+  highlight VisualNOS guifg=#b8bb26 guibg=#fe8019 gui=reverse ctermfg=142 ctermbg=208 cterm=reverse
+  highlight WarningMsg guifg=#3c3836 guibg=#504945 gui=undercurl ctermfg=237 ctermbg=239 cterm=undercurl
+  highlight WildMenu guifg=#83a598 guibg=#fb4934 gui=bold,italic ctermfg=109 ctermbg=167 cterm=bold,italic
+endif
+
+highlight! link vimCommand Statement
+highlight! link vimFuncName Function
+highlight! link vimVar Identifier
+highlight! link vimString String
+highlight! link vimNumber Number
+highlight! link vimOper Operator
+highlight! link vimComment Comment
+highlight! link vim9Comment Comment
+highlight! link vimMapLhs Special
+highlight! link vimMapRhs Constant
+highlight! link vimHighlight Statement
+highlight! link vimGroup Type
+highlight! link vimHiAttrib PreProc
+highlight! link vimAutoCmd Keyword
+highlight! link vimAutoEvent Type
+highlight! link vimOption PreProc
+highlight! link vimSetEqual Operator
+highlight! link vimUserCommand Function
+highlight! link vimLet Statement
+highlight! link vimNotFunc Conditional
+
+highlight User1 guifg=#1d2021 guibg=#3c3836 ctermfg=234 ctermbg=237
+highlight User2 guifg=#ebdbb2 guibg=#3c3836 ctermfg=223 ctermbg=237
+highlight User3 guifg=#fb4934 guibg=#3c3836 ctermfg=167 ctermbg=237
+highlight User4 guifg=#b8bb26 guibg=#3c3836 ctermfg=142 ctermbg=237
+highlight User5 guifg=#fabd2f guibg=#3c3836 ctermfg=214 ctermbg=237
+highlight User6 guifg=#83a598 guibg=#3c3836 ctermfg=109 ctermbg=237
+highlight User7 guifg=#d3869b guibg=#3c3836 ctermfg=175 ctermbg=237
+highlight User8 guifg=#8ec07c guibg=#3c3836 ctermfg=108 ctermbg=237
+highlight User9 guifg=#fe8019 guibg=#3c3836 ctermfg=208 ctermbg=237
+highlight User10 guifg=#928374 guibg=#3c3836 ctermfg=245 ctermbg=237
+highlight User11 guifg=#3c3836 guibg=#3c3836 ctermfg=237 ctermbg=237
+highlight User12 guifg=#504945 guibg=#3c3836 ctermfg=239 ctermbg=237
+
+g:terminal_ansi_colors = [
+  '#1d2021',
+  '#ebdbb2',
+  '#fb4934',
+  '#b8bb26',
+  '#fabd2f',
+  '#83a598',
+  '#d3869b',
+  '#8ec07c',
+  '#fe8019',
+  '#928374',
+  '#3c3836',
+  '#504945',
+  '#1d2021',
+  '#ebdbb2',
+  '#fb4934',
+  '#b8bb26',
+]
@@ -0,0 +1,343 @@
+vim9script
+
+# 简化的 LSP 客户端：大量 def 的长函数体
+
+const LSP_VERSION = '3.17'
+const LSP_TIMEOUT = 2000
+
+var servers: dict<any> = {}
+var pending: dict<any> = {}
+var next_id = 1
+var diagnostics = {}
+var file_versions = {}
+var log_lines = []
+
+export def Log(msg: string)
+  log_lines->add(strftime('%H:%M:%S') .. ' ' .. msg)
+  if len(log_lines) > 1000
+    log_lines = log_lines[500 : ]
+  endif
+enddef
+
+def NextId(): number
+  var id = next_id
+  next_id += 1
+  return id
+enddef
+
+def ServerFor(ft: string): dict<any>
+  if has_key(servers, ft)
+    return servers[ft]
+  endif
+  return {}
+enddef
+
+export def Register(ft: string, cmd: list<string>, opts: dict<any>)
+  servers[ft] = {
+    filetype: ft,
+    cmd: cmd,
+    opts: opts,
+    job: v:none,
+    channel: v:none,
+    ready: false,
+    capabilities: {},
+    queue: [],
+  }
+  Log('registered server for ' .. ft)
+enddef
+
+def Encode(msg: dict<any>): string
+  var body = json_encode(msg)
+  return 'Content-Length: ' .. len(body) .. "\r\n\r\n" .. body
+enddef
+
+def Send(server: dict<any>, msg: dict<any>)
+  if !server.ready
+    server.queue->add(msg)
+    return
+  endif
+  ch_sendraw(server.channel, Encode(msg))
+enddef
+
+export def Request(ft: string, method: string, params: dict<any>, Callback: func)
+  var server = ServerFor(ft)
+  if empty(server)
+    Log('no server for ' .. ft)
+    return
+  endif
+  var id = NextId()
+  pending[id] = {method: method, callback: Callback, time: reltime()}
+  Send(server, {jsonrpc: '2.0', id: id, method: method, params: params})
+enddef
+
+export def Notify(ft: string, method: string, params: dict<any>)
+  var server = ServerFor(ft)
+  if empty(server)
+    return
+  endif
+  Send(server, {jsonrpc: '2.0', method: method, params: params})
+enddef
+
+def OnResponse(msg: dict<any>)
+  if !has_key(pending, msg.id)
+    Log('unexpected response ' .. msg.id)
+    return
+  endif
+  var req = pending[msg.id]
+  remove(pending, msg.id)
+  var elapsed = reltimefloat(reltime(req.time)) * 1000.0
+  Log(req.method .. ' took ' .. printf('%.1f', elapsed) .. 'ms')
+  if has_key(msg, 'error')
+    Log('error: ' .. msg.error.message)
+    return
+  endif
+  req.callback(msg.result)
+enddef
+
+def OnDiagnostics(params: dict<any>)
+  var uri = params.uri
+  var items = []
+  for d in params.diagnostics
+    var severity = get(d, 'severity', 1)
+    var type = 'E'
+    if severity == 2
+      type = 'W'
+    elseif severity == 3
+      type = 'I'
+    elseif severity == 4
+      type = 'N'
+    endif
+    items->add({
+      filename: UriToPath(uri),
+      lnum: d.range.start.line + 1,
+      col: d.range.start.character + 1,
+      end_lnum: d.range.end.line + 1,
+      end_col: d.range.end.character + 1,
+      text: d.message,
+      type: type,
+    })
+  endfor
+  diagnostics[uri] = items
+  setloclist(0, items, 'r')
+enddef
+
+def OnMessage(msg: dict<any>)
+  if has_key(msg, 'id') && has_key(msg, 'method')
+    Log('server request ' .. msg.method)
+  elseif has_key(msg, 'id')
+    OnResponse(msg)
+  elseif msg.method == 'textDocument/publishDiagnostics'
+    OnDiagnostics(msg.params)
+  elseif msg.method == 'window/logMessage'
+    Log(msg.params.message)
+  else
+    Log('unhandled notification ' .. msg.method)
+  endif
+enddef
+
+export def UriToPath(uri: string): string
+  var path = substitute(uri, '^file://', '', '')
+  return substitute(path, '%\(\x\x\)', (m) => nr2char(str2nr(m[1], 16)), 'g')
+enddef
+
+export def PathToUri(path: string): string
+  return 'file://' .. fnamemodify(path, ':p')
+enddef
+
+def Position(): dict<any>
+  var pos = getcurpos()
+  return {line: pos[1] - 1, character: pos[2] - 1}
+enddef
+
+def TextDocument(): dict<any>
+  return {uri: PathToUri(expand('%'))}
+enddef
+
+export def DidOpen()
+  var ft = &filetype
+  var uri = PathToUri(expand('%'))
+  file_versions[uri] = 1
+  Notify(ft, 'textDocument/didOpen', {
+    textDocument: {
+      uri: uri,
+      languageId: ft,
+      version: 1,
+      text: join(getline(1, '$'), "\n"),
+    },
+  })
+enddef
+
+export def DidChange()
+  var ft = &filetype
+  var uri = PathToUri(expand('%'))
+  file_versions[uri] = get(file_versions, uri, 0) + 1
+  Notify(ft, 'textDocument/didChange', {
+    textDocument: {uri: uri, version: file_versions[uri]},
+    contentChanges: [{text: join(getline(1, '$'), "\n")}],
+  })
+enddef
+
+export def DidClose()
+  var uri = PathToUri(expand('%'))
+  Notify(&filetype, 'textDocument/didClose', {textDocument: {uri: uri}})
+  if has_key(file_versions, uri)
+    remove(file_versions, uri)
+  endif
+enddef
+
+def JumpTo(location: dict<any>)
+  var path = UriToPath(location.uri)
+  if path != expand('%:p')
+    execute 'edit ' .. fnameescape(path)
+  endif
+  cursor(location.range.start.line + 1, location.range.start.character + 1)
+  normal! zz
+enddef
+
+def OnDefinition(result: any)
+  if type(result) == v:t_list
+    if empty(result)
+      echo 'no definition'
+      return
+    endif
+    JumpTo(result[0])
+  elseif type(result) == v:t_dict
+    JumpTo(result)
+  endif
+enddef
+
+export def GotoDefinition()
+  Request(&filetype, 'textDocument/definition', {
+    textDocument: TextDocument(),
+    position: Position(),
+  }, OnDefinition)
+enddef
+
+def OnHover(result: any)
+  if type(result) != v:t_dict
+    return
+  endif
+  var contents = result.contents
+  var lines = []
+  if type(contents) == v:t_string
+    lines = split(contents, "\n")
+  elseif type(contents) == v:t_dict
+    lines = split(contents.value, "\n")
+  elseif type(contents) == v:t_list
+    for c in contents
+      if type(c) == v:t_string
+        lines += split(c, "\n")
+      else
+        lines += split(c.value, "\n")
+      endif
+    endfor
+  endif
+  if empty(lines)
+    return
+  endif
+  popup_atcursor(lines, {
+    padding: [0, 1, 0, 1],
+    border: [],
+    maxwidth: 80,
+    moved: 'any',
+  })
+enddef
+
+export def Hover()
+  Request(&filetype, 'textDocument/hover', {
+    textDocument: TextDocument(),
+    position: Position(),
+  }, OnHover)
+enddef
+
+def OnReferences(result: any)
+  var items = []
+  for loc in result
+    items->add({
+      filename: UriToPath(loc.uri),
+      lnum: loc.range.start.line + 1,
+      col: loc.range.start.character + 1,
+      text: getline(loc.range.start.line + 1),
+    })
+  endfor
+  setqflist(items, 'r')
+  copen
+enddef
+
+export def References()
+  Request(&filetype, 'textDocument/references', {
+    textDocument: TextDocument(),
+    position: Position(),
+    context: {includeDeclaration: true},
+  }, OnReferences)
+enddef
+
+def CompletionKind(kind: number): string
+  var kinds = [
+    '', 'text', 'method', 'function', 'constructor', 'field',
+    'variable', 'class', 'interface', 'module', 'property',
+    'unit', 'value', 'enum', 'keyword', 'snippet', 'color',
+    'file', 'reference', 'folder', 'enummember', 'constant',
+    'struct', 'event', 'operator', 'typeparameter',
+  ]
+  if kind > 0 && kind < len(kinds)
+    return kinds[kind]
+  endif
+  return ''
+enddef
+
+def OnCompletion(result: any)
+  var items = type(result) == v:t_dict ? result.items : result
+  var matches = []
+  for item in items
+    matches->add({
+      word: get(item, 'insertText', item.label),
+      abbr: item.label,
+      kind: CompletionKind(get(item, 'kind', 0)),
+      menu: get(item, 'detail', ''),
+      dup: 1,
+    })
+  endfor
+  complete(col('.') - len(matchstr(getline('.')[ : col('.') - 2], '\k*$')), matches)
+enddef
+
+export def Complete()
+  Request(&filetype, 'textDocument/completion', {
+    textDocument: TextDocument(),
+    position: Position(),
+    context: {triggerKind: 1},
+  }, OnCompletion)
+enddef
+
+def OnFormatting(result: any)
+  if type(result) != v:t_list || empty(result)
+    return
+  endif
+  var edits = sort(copy(result), (a, b) => b.range.start.line - a.range.start.line)
+  for edit in edits
+    var start = edit.range.start
+    var end = edit.range.end
+    var before = getline(start.line + 1)[ : start.character - 1]
+    var after = getline(end.line + 1)[end.character : ]
+    var lines = split(before .. edit.newText .. after, "\n", true)
+    deletebufline('%', start.line + 1, end.line + 1)
+    append(start.line, lines)
+  endfor
+enddef
+
+export def Format()
+  Request(&filetype, 'textDocument/formatting', {
+    textDocument: TextDocument(),
+    options: {tabSize: &shiftwidth, insertSpaces: &expandtab},
+  }, OnFormatting)
+enddef
+
+export def Status(): string
+  var server = ServerFor(&filetype)
+  if empty(server)
+    return ''
+  endif
+  var uri = PathToUri(expand('%'))
+  var count = len(get(diagnostics, uri, []))
+  return server.ready ? 'LSP(' .. count .. ')' : 'LSP...'
+enddef
@@ -0,0 +1,195 @@
+vim9script
+
+# 以映射为主的 vimrc 片段
+
+g:mapleader = ' '
+g:maplocalleader = ','
+
+set nocompatible
+set hidden
+set number
+set relativenumber
+set signcolumn=yes
+set updatetime=300
+set timeoutlen=500
+set ttimeoutlen=10
+set scrolloff=5
+set sidescrolloff=8
+set splitbelow
+set splitright
+set ignorecase
+set smartcase
+set incsearch
+set hlsearch
+set wildmenu
+set wildmode=longest:full,full
+set expandtab
+set shiftwidth=2
+set tabstop=2
+set softtabstop=2
+set undofile
+set backspace=indent,eol,start
+set completeopt=menuone,noinsert,noselect
+set shortmess+=c
+
+# 窗口
+nnoremap <C-h> <C-w>h
+nnoremap <C-j> <C-w>j
+nnoremap <C-k> <C-w>k
+nnoremap <C-l> <C-w>l
+nnoremap <silent> <leader>wv :vsplit<CR>
+nnoremap <silent> <leader>ws :split<CR>
+nnoremap <silent> <leader>wc :close<CR>
+nnoremap <silent> <leader>wo :only<CR>
+nnoremap <silent> <leader>w= <C-w>=
+nnoremap <silent> <M-Left> :vertical resize -2<CR>
+nnoremap <silent> <M-Right> :vertical resize +2<CR>
+nnoremap <silent> <M-Up> :resize +2<CR>
+nnoremap <silent> <M-Down> :resize -2<CR>
+tnoremap <Esc><Esc> <C-\><C-n>
+tnoremap <C-h> <C-\><C-n><C-w>h
+tnoremap <C-j> <C-\><C-n><C-w>j
+tnoremap <C-k> <C-\><C-n><C-w>k
+tnoremap <C-l> <C-\><C-n><C-w>l
+
+# 缓冲区
+nnoremap <silent> <leader>bn :bnext<CR>
+nnoremap <silent> <leader>bp :bprevious<CR>
+nnoremap <silent> <leader>bd :bdelete<CR>
+nnoremap <silent> <leader>bD :bdelete!<CR>
+nnoremap <silent> <leader>ba :ball<CR>
+nnoremap <silent> <leader>bl :ls<CR>
+nnoremap <silent> [b :bprevious<CR>
+nnoremap <silent> ]b :bnext<CR>
+nnoremap <silent> [B :bfirst<CR>
+nnoremap <silent> ]B :blast<CR>
+
+# quickfix / location list
+nnoremap <silent> [q :cprevious<CR>
+nnoremap <silent> ]q :cnext<CR>
+nnoremap <silent> [Q :cfirst<CR>
+nnoremap <silent> ]Q :clast<CR>
+nnoremap <silent> [l :lprevious<CR>
+nnoremap <silent> ]l :lnext<CR>
+nnoremap <silent> <leader>qo :copen<CR>
+nnoremap <silent> <leader>qc :cclose<CR>
+nnoremap <silent> <leader>lo :lopen<CR>
+nnoremap <silent> <leader>lc :lclose<CR>
+
+# 编辑
+nnoremap Y y$
+nnoremap n nzzzv
+nnoremap N Nzzzv
+nnoremap J mzJ`z
+nnoremap <silent> <Esc> :nohlsearch<CR><Esc>
+nnoremap <silent> <leader>s :write<CR>
+nnoremap <silent> <leader>S :wall<CR>
+nnoremap <silent> <leader>x :xit<CR>
+nnoremap <silent> <leader>Q :qall!<CR>
+nnoremap <leader>r :%s/\<<C-r><C-w>\>//g<Left><Left>
+nnoremap <leader>R :%s/\<<C-r><C-w>\>/<C-r><C-w>/g<Left><Left>
+vnoremap < <gv
+vnoremap > >gv
+vnoremap J :m '>+1<CR>gv=gv
+vnoremap K :m '<-2<CR>gv=gv
+xnoremap <leader>p "_dP
+xnoremap <leader>y "+y
+nnoremap <leader>y "+y
+nnoremap <leader>Y "+y$
+nnoremap <leader>d "_d
+vnoremap <leader>d "_d
+inoremap <C-a> <Home>
+inoremap <C-e> <End>
+inoremap <C-b> <Left>
+inoremap <C-f> <Right>
+inoremap <C-d> <Del>
+inoremap jk <Esc>
+inoremap , ,<C-g>u
+inoremap . .<C-g>u
+inoremap ! !<C-g>u
+inoremap ? ?<C-g>u
+cnoremap <C-a> <Home>
+cnoremap <C-e> <End>
+cnoremap <C-p> <Up>
+cnoremap <C-n> <Down>
+cnoremap <C-b> <Left>
+cnoremap <C-f> <Right>
+cnoremap %% <C-r>=expand('%:h') .. '/'<CR>
+
+# 文本对象
+onoremap <silent> il :<C-u>normal! ^vg_<CR>
+xnoremap <silent> il :<C-u>normal! ^vg_<CR>
+onoremap <silent> al :<C-u>normal! 0v$<CR>
+xnoremap <silent> al :<C-u>normal! 0v$<CR>
+onoremap <silent> ie :<C-u>normal! ggVG<CR>
+xnoremap <silent> ie :<C-u>normal! ggVG<CR>
+
+# 插件
+nnoremap <silent> <leader>ff :call fzf#run({'sink': 'edit'})<CR>
+nnoremap <silent> <leader>fb :Buffers<CR>
+nnoremap <silent> <leader>fg :Rg<CR>
+nnoremap <silent> <leader>fh :Helptags<CR>
+nnoremap <silent> <leader>fl :BLines<CR>
+nnoremap <silent> <leader>fm :Marks<CR>
+nnoremap <silent> <leader>fr :History<CR>
+nnoremap <silent> <leader>f: :History:<CR>
+nnoremap <silent> <leader>f/ :History/<CR>
+nnoremap <silent> <leader>gs :Git<CR>
+nnoremap <silent> <leader>gb :Git blame<CR>
+nnoremap <silent> <leader>gd :Gdiffsplit<CR>
+nnoremap <silent> <leader>gl :Git log --oneline<CR>
+nnoremap <silent> <leader>gp :Git push<CR>
+nnoremap <silent> ]h :call GitGutterNextHunk()<CR>
+nnoremap <silent> [h :call GitGutterPrevHunk()<CR>
+nnoremap <silent> <leader>e :call ToggleExplorer()<CR>
+nnoremap <silent> <leader>u :UndotreeToggle<CR>
+nnoremap <silent> <leader>t :call ToggleTerminal()<CR>
+nnoremap <silent> gd :call lsp#GotoDefinition()<CR>
+nnoremap <silent> gr :call lsp#References()<CR>
+nnoremap <silent> K :call lsp#Hover()<CR>
+nnoremap <silent> <leader>cf :call lsp#Format()<CR>
+nnoremap <silent> <leader>ca :call lsp#CodeAction()<CR>
+nnoremap <silent> <leader>cr :call lsp#Rename()<CR>
+inoremap <silent> <C-Space> <C-o>:call lsp#Complete()<CR>
+imap <silent> <Tab> <Plug>(snippet-expand-or-jump)
+smap <silent> <Tab> <Plug>(snippet-expand-or-jump)
+imap <silent> <S-Tab> <Plug>(snippet-jump-prev)
+smap <silent> <S-Tab> <Plug>(snippet-jump-prev)
+nmap <leader>cc <Plug>CommentaryLine
+xmap <leader>cc <Plug>Commentary
+omap <leader>cc <Plug>Commentary
+nmap s <Plug>(easymotion-s2)
+nmap <leader>j <Plug>(easymotion-j)
+nmap <leader>k <Plug>(easymotion-k)
+map <F1> <Nop>
+imap <F1> <Nop>
+noremap <F2> :set invpaste paste?<CR>
+noremap <silent> <F5> :call RunCurrentFile()<CR>
+noremap <silent> <F9> :make<CR>
+noremap <silent> <F10> :call ToggleQuickfix()<CR>
+
+# 折叠
+nnoremap <silent> <leader>z0 :set foldlevel=0<CR>
+nnoremap <silent> <leader>z1 :set foldlevel=1<CR>
+nnoremap <silent> <leader>z2 :set foldlevel=2<CR>
+nnoremap <silent> <leader>z9 :set foldlevel=99<CR>
+nnoremap <silent> <Tab> za
+
+command! -nargs=0 Vimrc edit $MYVIMRC
+command! -nargs=0 ReloadVimrc source $MYVIMRC
+command! -nargs=? -complete=filetype EditFtplugin execute 'edit ~/.vim/ftplugin/' .. (empty(<q-args>) ? &filetype : <q-args>) .. '.vim'
+command! -bang -nargs=* Rg call fzf#vim#grep('rg --column --line-number --no-heading --color=always --smart-case ' .. shellescape(<q-args>), 1, <bang>0)
+command! -range=% TrimWhitespace <line1>,<line2>s/\s\+$//e
+
+augroup vimrc
+  autocmd!
+  autocmd BufWritePre *.vim,*.lua,*.py TrimWhitespace
+  autocmd FileType vim setlocal foldmethod=marker
+  autocmd FileType python setlocal shiftwidth=4 tabstop=4
+  autocmd FileType go setlocal noexpandtab
+  autocmd FileType help nnoremap <buffer> <silent> q :close<CR>
+  autocmd FileType qf nnoremap <buffer> <silent> q :cclose<CR>
+  autocmd TermOpen * setlocal nonumber norelativenumber
+  autocmd VimResized * wincmd =
+  autocmd BufReadPost * if line("'\"") > 1 && line("'\"") <= line("$") | execute "normal! g`\"" | endif
+augroup END
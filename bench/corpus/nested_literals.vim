@@ -0,0 +1,199 @@
+vim9script
+
+# 深层嵌套的 dict / list 字面量
+
+const PALETTE = {
+  dark: {
+    bg: ['#1d2021', 234],
+    fg: ['#ebdbb2', 223],
+    red: ['#fb4934', 167],
+    green: ['#b8bb26', 142],
+    yellow: ['#fabd2f', 214],
+    blue: ['#83a598', 109],
+    purple: ['#d3869b', 175],
+    aqua: ['#8ec07c', 108],
+    orange: ['#fe8019', 208],
+    gray: ['#928374', 245],
+  },
+  light: {
+    bg: ['#fbf1c7', 230],
+    fg: ['#3c3836', 237],
+    red: ['#9d0006', 88],
+    green: ['#79740e', 100],
+    yellow: ['#b57614', 136],
+    blue: ['#076678', 24],
+    purple: ['#8f3f71', 96],
+    aqua: ['#427b58', 66],
+    orange: ['#af3a03', 130],
+    gray: ['#928374', 245],
+  },
+}
+
+g:lsp_servers = {
+  python: {
+    cmd: ['pyright-langserver', '--stdio'],
+    root_markers: ['pyproject.toml', 'setup.py', 'setup.cfg', '.git'],
+    settings: {
+      python: {
+        analysis: {
+          autoSearchPaths: true,
+          useLibraryCodeForTypes: true,
+          diagnosticMode: 'workspace',
+          typeCheckingMode: 'basic',
+          diagnosticSeverityOverrides: {
+            reportMissingImports: 'warning',
+            reportMissingTypeStubs: 'none',
+            reportOptionalMemberAccess: 'information',
+          },
+        },
+      },
+    },
+  },
+  rust: {
+    cmd: ['rust-analyzer'],
+    root_markers: ['Cargo.toml', '.git'],
+    settings: {
+      'rust-analyzer': {
+        cargo: {
+          allFeatures: true,
+          buildScripts: {enable: true},
+        },
+        checkOnSave: {
+          command: 'clippy',
+          extraArgs: ['--', '-W', 'clippy::pedantic'],
+        },
+        procMacro: {enable: true},
+        inlayHints: {
+          typeHints: {enable: true},
+          parameterHints: {enable: true},
+          chainingHints: {enable: false},
+        },
+      },
+    },
+  },
+  go: {
+    cmd: ['gopls'],
+    root_markers: ['go.mod', '.git'],
+    settings: {
+      gopls: {
+        usePlaceholders: true,
+        staticcheck: true,
+        analyses: {
+          unusedparams: true,
+          shadow: true,
+          nilness: true,
+        },
+        codelenses: {
+          generate: true,
+          test: true,
+          tidy: true,
+        },
+      },
+    },
+  },
+  c: {
+    cmd: ['clangd', '--background-index', '--clang-tidy'],
+    root_markers: ['compile_commands.json', 'CMakeLists.txt', '.git'],
+    filetypes: ['c', 'cpp', 'objc'],
+    settings: {},
+  },
+}
+
+g:statusline_layout = [
+  [
+    {name: 'mode', highlight: 'StatusMode', min_width: 0},
+    {name: 'git', highlight: 'StatusGit', min_width: 80},
+    {name: 'file', highlight: 'StatusFile', min_width: 0},
+  ],
+  [
+    {name: 'diagnostics', highlight: 'StatusWarn', min_width: 60},
+    {name: 'lsp', highlight: 'StatusInfo', min_width: 100},
+    {name: 'filetype', highlight: 'StatusInfo', min_width: 70},
+    {name: 'position', highlight: 'StatusMode', min_width: 0},
+  ],
+]
+
+var matrix = [
+  [[1, 2, 3], [4, 5, 6], [7, 8, 9]],
+  [[10, 11, 12], [13, 14, 15], [16, 17, 18]],
+  [[19, 20, 21], [22, 23, 24], [25, 26, 27]],
+]
+
+var tree = {
+  name: 'root',
+  children: [
+    {
+      name: 'src',
+      children: [
+        {name: 'main.c', children: []},
+        {name: 'util.c', children: []},
+        {
+          name: 'lib',
+          children: [
+            {name: 'list.c', children: []},
+            {name: 'dict.c', children: []},
+            {
+              name: 'internal',
+              children: [
+                {name: 'alloc.c', children: []},
+                {name: 'hash.c', children: []},
+                {
+                  name: 'arch',
+                  children: [
+                    {name: 'x86.c', children: []},
+                    {name: 'arm.c', children: []},
+                  ],
+                },
+              ],
+            },
+          ],
+        },
+      ],
+    },
+    {
+      name: 'test',
+      children: [
+        {name: 'test_list.c', children: []},
+        {name: 'test_dict.c', children: []},
+      ],
+    },
+  ],
+}
+
+g:snippets = {
+  vim: [
+    {trigger: 'def', body: ['def ${1:Name}(${2})', '  ${0}', 'enddef']},
+    {trigger: 'if', body: ['if ${1:cond}', '  ${0}', 'endif']},
+    {trigger: 'for', body: ['for ${1:item} in ${2:list}', '  ${0}', 'endfor']},
+    {trigger: 'aug', body: ['augroup ${1:name}', '  autocmd!', '  ${0}', 'augroup END']},
+  ],
+  c: [
+    {trigger: 'main', body: ['int main(int argc, char **argv) {', '    ${0}', '    return 0;', '}']},
+    {trigger: 'for', body: ['for (int ${1:i} = 0; $1 < ${2:n}; $1++) {', '    ${0}', '}']},
+    {trigger: 'inc', body: ['#include <${1:stdio.h}>']},
+  ],
+}
+
+def Depth(node: dict<any>): number
+  var best = 0
+  for child in node.children
+    var d = Depth(child)
+    if d > best
+      best = d
+    endif
+  endfor
+  return best + 1
+enddef
+
+def Flatten(node: dict<any>, prefix: string): list<string>
+  var path = prefix == '' ? node.name : prefix .. '/' .. node.name
+  var out = [path]
+  for child in node.children
+    out += Flatten(child, path)
+  endfor
+  return out
+enddef
+
+g:tree_depth = Depth(tree)
+g:tree_paths = Flatten(tree, '')
+g:colors = PALETTE[&background]->map((key, value) => value[0])
@@ -0,0 +1,505 @@
+vim9script
+# 很长的 | 链、很长的映射参数和很长的二元表达式
+echo 0 | echo 1 | echo 2 | echo 3 | echo 4 | echo 5 | echo 6 | echo 7 | echo 8 | echo 9 | echo 10 | echo 11 | echo 12 | echo 13 | echo 14 | echo 15 | echo 16 | echo 17 | echo 18 | echo 19 | echo 20 | echo 21 | echo 22 | echo 23 | echo 24 | echo 25 | echo 26 | echo 27 | echo 28 | echo 29 | echo 30 | echo 31 | echo 32 | echo 33 | echo 34 | echo 35 | echo 36 | echo 37 | echo 38 | echo 39 | echo 40 | echo 41 | echo 42 | echo 43 | echo 44 | echo 45 | echo 46 | echo 47 | echo 48 | echo 49 | echo 50 | echo 51 | echo 52 | echo 53 | echo 54 | echo 55 | echo 56 | echo 57 | echo 58 | echo 59 | echo 60 | echo 61 | echo 62 | echo 63 | echo 64 | echo 65 | echo 66 | echo 67 | echo 68 | echo 69 | echo 70 | echo 71 | echo 72 | echo 73 | echo 74 | echo 75 | echo 76 | echo 77 | echo 78 | echo 79 | echo 80 | echo 81 | echo 82 | echo 83 | echo 84 | echo 85 | echo 86 | echo 87 | echo 88 | echo 89 | echo 90 | echo 91 | echo 92 | echo 93 | echo 94 | echo 95 | echo 96 | echo 97 | echo 98 | echo 99 | echo 100 | echo 101 | echo 102 | echo 103 | echo 104 | echo 105 | echo 106 | echo 107 | echo 108 | echo 109 | echo 110 | echo 111 | echo 112 | echo 113 | echo 114 | echo 115 | echo 116 | echo 117 | echo 118 | echo 119 | echo 120 | echo 121 | echo 122 | echo 123 | echo 124 | echo 125 | echo 126 | echo 127 | echo 128 | echo 129 | echo 130 | echo 131 | echo 132 | echo 133 | echo 134 | echo 135 | echo 136 | echo 137 | echo 138 | echo 139 | echo 140 | echo 141 | echo 142 | echo 143 | echo 144 | echo 145 | echo 146 | echo 147 | echo 148 | echo 149 | echo 150 | echo 151 | echo 152 | echo 153 | echo 154 | echo 155 | echo 156 | echo 157 | echo 158 | echo 159 | echo 160 | echo 161 | echo 162 | echo 163 | echo 164 | echo 165 | echo 166 | echo 167 | echo 168 | echo 169 | echo 170 | echo 171 | echo 172 | echo 173 | echo 174 | echo 175 | echo 176 | echo 177 | echo 178 | echo 179 | echo 180 | echo 181 | echo 182 | echo 183 | echo 184 | echo 185 | echo 186 | echo 187 | echo 188 | echo 189 | echo 190 | echo 191 | echo 192 | echo 193 | echo 194 | echo 195 | echo 196 | echo 197 | echo 198 | echo 199 | echo 200 | echo 201 | echo 202 | echo 203 | echo 204 | echo 205 | echo 206 | echo 207 | echo 208 | echo 209 | echo 210 | echo 211 | echo 212 | echo 213 | echo 214 | echo 215 | echo 216 | echo 217 | echo 218 | echo 219 | echo 220 | echo 221 | echo 222 | echo 223 | echo 224 | echo 225 | echo 226 | echo 227 | echo 228 | echo 229 | echo 230 | echo 231 | echo 232 | echo 233 | echo 234 | echo 235 | echo 236 | echo 237 | echo 238 | echo 239 | echo 240 | echo 241 | echo 242 | echo 243 | echo 244 | echo 245 | echo 246 | echo 247 | echo 248 | echo 249 | echo 250 | echo 251 | echo 252 | echo 253 | echo 254 | echo 255 | echo 256 | echo 257 | echo 258 | echo 259 | echo 260 | echo 261 | echo 262 | echo 263 | echo 264 | echo 265 | echo 266 | echo 267 | echo 268 | echo 269 | echo 270 | echo 271 | echo 272 | echo 273 | echo 274 | echo 275 | echo 276 | echo 277 | echo 278 | echo 279 | echo 280 | echo 281 | echo 282 | echo 283 | echo 284 | echo 285 | echo 286 | echo 287 | echo 288 | echo 289 | echo 290 | echo 291 | echo 292 | echo 293 | echo 294 | echo 295 | echo 296 | echo 297 | echo 298 | echo 299 | echo 300 | echo 301 | echo 302 | echo 303 | echo 304 | echo 305 | echo 306 | echo 307 | echo 308 | echo 309 | echo 310 | echo 311 | echo 312 | echo 313 | echo 314 | echo 315 | echo 316 | echo 317 | echo 318 | echo 319 | echo 320 | echo 321 | echo 322 | echo 323 | echo 324 | echo 325 | echo 326 | echo 327 | echo 328 | echo 329 | echo 330 | echo 331 | echo 332 | echo 333 | echo 334 | echo 335 | echo 336 | echo 337 | echo 338 | echo 339 | echo 340 | echo 341 | echo 342 | echo 343 | echo 344 | echo 345 | echo 346 | echo 347 | echo 348 | echo 349 | echo 350 | echo 351 | echo 352 | echo 353 | echo 354 | echo 355 | echo 356 | echo 357 | echo 358 | echo 359 | echo 360 | echo 361 | echo 362 | echo 363 | echo 364 | echo 365 | echo 366 | echo 367 | echo 368 | echo 369 | echo 370 | echo 371 | echo 372 | echo 373 | echo 374 | echo 375 | echo 376 | echo 377 | echo 378 | echo 379 | echo 380 | echo 381 | echo 382 | echo 383 | echo 384 | echo 385 | echo 386 | echo 387 | echo 388 | echo 389 | echo 390 | echo 391 | echo 392 | echo 393 | echo 394 | echo 395 | echo 396 | echo 397 | echo 398 | echo 399 | echo 400 | echo 401 | echo 402 | echo 403 | echo 404 | echo 405 | echo 406 | echo 407 | echo 408 | echo 409 | echo 410 | echo 411 | echo 412 | echo 413 | echo 414 | echo 415 | echo 416 | echo 417 | echo 418 | echo 419 | echo 420 | echo 421 | echo 422 | echo 423 | echo 424 | echo 425 | echo 426 | echo 427 | echo 428 | echo 429 | echo 430 | echo 431 | echo 432 | echo 433 | echo 434 | echo 435 | echo 436 | echo 437 | echo 438 | echo 439 | echo 440 | echo 441 | echo 442 | echo 443 | echo 444 | echo 445 | echo 446 | echo 447 | echo 448 | echo 449 | echo 450 | echo 451 | echo 452 | echo 453 | echo 454 | echo 455 | echo 456 | echo 457 | echo 458 | echo 459 | echo 460 | echo 461 | echo 462 | echo 463 | echo 464 | echo 465 | echo 466 | echo 467 | echo 468 | echo 469 | echo 470 | echo 471 | echo 472 | echo 473 | echo 474 | echo 475 | echo 476 | echo 477 | echo 478 | echo 479 | echo 480 | echo 481 | echo 482 | echo 483 | echo 484 | echo 485 | echo 486 | echo 487 | echo 488 | echo 489 | echo 490 | echo 491 | echo 492 | echo 493 | echo 494 | echo 495 | echo 496 | echo 497 | echo 498 | echo 499 | echo 500 | echo 501 | echo 502 | echo 503 | echo 504 | echo 505 | echo 506 | echo 507 | echo 508 | echo 509 | echo 510 | echo 511 | echo 512 | echo 513 | echo 514 | echo 515 | echo 516 | echo 517 | echo 518 | echo 519 | echo 520 | echo 521 | echo 522 | echo 523 | echo 524 | echo 525 | echo 526 | echo 527 | echo 528 | echo 529 | echo 530 | echo 531 | echo 532 | echo 533 | echo 534 | echo 535 | echo 536 | echo 537 | echo 538 | echo 539 | echo 540 | echo 541 | echo 542 | echo 543 | echo 544 | echo 545 | echo 546 | echo 547 | echo 548 | echo 549 | echo 550 | echo 551 | echo 552 | echo 553 | echo 554 | echo 555 | echo 556 | echo 557 | echo 558 | echo 559 | echo 560 | echo 561 | echo 562 | echo 563 | echo 564 | echo 565 | echo 566 | echo 567 | echo 568 | echo 569 | echo 570 | echo 571 | echo 572 | echo 573 | echo 574 | echo 575 | echo 576 | echo 577 | echo 578 | echo 579 | echo 580 | echo 581 | echo 582 | echo 583 | echo 584 | echo 585 | echo 586 | echo 587 | echo 588 | echo 589 | echo 590 | echo 591 | echo 592 | echo 593 | echo 594 | echo 595 | echo 596 | echo 597 | echo 598 | echo 599 | echo 600 | echo 601 | echo 602 | echo 603 | echo 604 | echo 605 | echo 606 | echo 607 | echo 608 | echo 609 | echo 610 | echo 611 | echo 612 | echo 613 | echo 614 | echo 615 | echo 616 | echo 617 | echo 618 | echo 619 | echo 620 | echo 621 | echo 622 | echo 623 | echo 624 | echo 625 | echo 626 | echo 627 | echo 628 | echo 629 | echo 630 | echo 631 | echo 632 | echo 633 | echo 634 | echo 635 | echo 636 | echo 637 | echo 638 | echo 639 | echo 640 | echo 641 | echo 642 | echo 643 | echo 644 | echo 645 | echo 646 | echo 647 | echo 648 | echo 649 | echo 650 | echo 651 | echo 652 | echo 653 | echo 654 | echo 655 | echo 656 | echo 657 | echo 658 | echo 659 | echo 660 | echo 661 | echo 662 | echo 663 | echo 664 | echo 665 | echo 666 | echo 667 | echo 668 | echo 669 | echo 670 | echo 671 | echo 672 | echo 673 | echo 674 | echo 675 | echo 676 | echo 677 | echo 678 | echo 679 | echo 680 | echo 681 | echo 682 | echo 683 | echo 684 | echo 685 | echo 686 | echo 687 | echo 688 | echo 689 | echo 690 | echo 691 | echo 692 | echo 693 | echo 694 | echo 695 | echo 696 | echo 697 | echo 698 | echo 699 | echo 700 | echo 701 | echo 702 | echo 703 | echo 704 | echo 705 | echo 706 | echo 707 | echo 708 | echo 709 | echo 710 | echo 711 | echo 712 | echo 713 | echo 714 | echo 715 | echo 716 | echo 717 | echo 718 | echo 719 | echo 720 | echo 721 | echo 722 | echo 723 | echo 724 | echo 725 | echo 726 | echo 727 | echo 728 | echo 729 | echo 730 | echo 731 | echo 732 | echo 733 | echo 734 | echo 735 | echo 736 | echo 737 | echo 738 | echo 739 | echo 740 | echo 741 | echo 742 | echo 743 | echo 744 | echo 745 | echo 746 | echo 747 | echo 748 | echo 749 | echo 750 | echo 751 | echo 752 | echo 753 | echo 754 | echo 755 | echo 756 | echo 757 | echo 758 | echo 759 | echo 760 | echo 761 | echo 762 | echo 763 | echo 764 | echo 765 | echo 766 | echo 767 | echo 768 | echo 769 | echo 770 | echo 771 | echo 772 | echo 773 | echo 774 | echo 775 | echo 776 | echo 777 | echo 778 | echo 779 | echo 780 | echo 781 | echo 782 | echo 783 | echo 784 | echo 785 | echo 786 | echo 787 | echo 788 | echo 789 | echo 790 | echo 791 | echo 792 | echo 793 | echo 794 | echo 795 | echo 796 | echo 797 | echo 798 | echo 799 | echo 800 | echo 801 | echo 802 | echo 803 | echo 804 | echo 805 | echo 806 | echo 807 | echo 808 | echo 809 | echo 810 | echo 811 | echo 812 | echo 813 | echo 814 | echo 815 | echo 816 | echo 817 | echo 818 | echo 819 | echo 820 | echo 821 | echo 822 | echo 823 | echo 824 | echo 825 | echo 826 | echo 827 | echo 828 | echo 829 | echo 830 | echo 831 | echo 832 | echo 833 | echo 834 | echo 835 | echo 836 | echo 837 | echo 838 | echo 839 | echo 840 | echo 841 | echo 842 | echo 843 | echo 844 | echo 845 | echo 846 | echo 847 | echo 848 | echo 849 | echo 850 | echo 851 | echo 852 | echo 853 | echo 854 | echo 855 | echo 856 | echo 857 | echo 858 | echo 859 | echo 860 | echo 861 | echo 862 | echo 863 | echo 864 | echo 865 | echo 866 | echo 867 | echo 868 | echo 869 | echo 870 | echo 871 | echo 872 | echo 873 | echo 874 | echo 875 | echo 876 | echo 877 | echo 878 | echo 879 | echo 880 | echo 881 | echo 882 | echo 883 | echo 884 | echo 885 | echo 886 | echo 887 | echo 888 | echo 889 | echo 890 | echo 891 | echo 892 | echo 893 | echo 894 | echo 895 | echo 896 | echo 897 | echo 898 | echo 899 | echo 900 | echo 901 | echo 902 | echo 903 | echo 904 | echo 905 | echo 906 | echo 907 | echo 908 | echo 909 | echo 910 | echo 911 | echo 912 | echo 913 | echo 914 | echo 915 | echo 916 | echo 917 | echo 918 | echo 919 | echo 920 | echo 921 | echo 922 | echo 923 | echo 924 | echo 925 | echo 926 | echo 927 | echo 928 | echo 929 | echo 930 | echo 931 | echo 932 | echo 933 | echo 934 | echo 935 | echo 936 | echo 937 | echo 938 | echo 939 | echo 940 | echo 941 | echo 942 | echo 943 | echo 944 | echo 945 | echo 946 | echo 947 | echo 948 | echo 949 | echo 950 | echo 951 | echo 952 | echo 953 | echo 954 | echo 955 | echo 956 | echo 957 | echo 958 | echo 959 | echo 960 | echo 961 | echo 962 | echo 963 | echo 964 | echo 965 | echo 966 | echo 967 | echo 968 | echo 969 | echo 970 | echo 971 | echo 972 | echo 973 | echo 974 | echo 975 | echo 976 | echo 977 | echo 978 | echo 979 | echo 980 | echo 981 | echo 982 | echo 983 | echo 984 | echo 985 | echo 986 | echo 987 | echo 988 | echo 989 | echo 990 | echo 991 | echo 992 | echo 993 | echo 994 | echo 995 | echo 996 | echo 997 | echo 998 | echo 999 | echo 1000 | echo 1001 | echo 1002 | echo 1003 | echo 1004 | echo 1005 | echo 1006 | echo 1007 | echo 1008 | echo 1009 | echo 1010 | echo 1011 | echo 1012 | echo 1013 | echo 1014 | echo 1015 | echo 1016 | echo 1017 | echo 1018 | echo 1019 | echo 1020 | echo 1021 | echo 1022 | echo 1023 | echo 1024 | echo 1025 | echo 1026 | echo 1027 | echo 1028 | echo 1029 | echo 1030 | echo 1031 | echo 1032 | echo 1033 | echo 1034 | echo 1035 | echo 1036 | echo 1037 | echo 1038 | echo 1039 | echo 1040 | echo 1041 | echo 1042 | echo 1043 | echo 1044 | echo 1045 | echo 1046 | echo 1047 | echo 1048 | echo 1049 | echo 1050 | echo 1051 | echo 1052 | echo 1053 | echo 1054 | echo 1055 | echo 1056 | echo 1057 | echo 1058 | echo 1059 | echo 1060 | echo 1061 | echo 1062 | echo 1063 | echo 1064 | echo 1065 | echo 1066 | echo 1067 | echo 1068 | echo 1069 | echo 1070 | echo 1071 | echo 1072 | echo 1073 | echo 1074 | echo 1075 | echo 1076 | echo 1077 | echo 1078 | echo 1079 | echo 1080 | echo 1081 | echo 1082 | echo 1083 | echo 1084 | echo 1085 | echo 1086 | echo 1087 | echo 1088 | echo 1089 | echo 1090 | echo 1091 | echo 1092 | echo 1093 | echo 1094 | echo 1095 | echo 1096 | echo 1097 | echo 1098 | echo 1099 | echo 1100 | echo 1101 | echo 1102 | echo 1103 | echo 1104 | echo 1105 | echo 1106 | echo 1107 | echo 1108 | echo 1109 | echo 1110 | echo 1111 | echo 1112 | echo 1113 | echo 1114 | echo 1115 | echo 1116 | echo 1117 | echo 1118 | echo 1119 | echo 1120 | echo 1121 | echo 1122 | echo 1123 | echo 1124 | echo 1125 | echo 1126 | echo 1127 | echo 1128 | echo 1129 | echo 1130 | echo 1131 | echo 1132 | echo 1133 | echo 1134 | echo 1135 | echo 1136 | echo 1137 | echo 1138 | echo 1139 | echo 1140 | echo 1141 | echo 1142 | echo 1143 | echo 1144 | echo 1145 | echo 1146 | echo 1147 | echo 1148 | echo 1149 | echo 1150 | echo 1151 | echo 1152 | echo 1153 | echo 1154 | echo 1155 | echo 1156 | echo 1157 | echo 1158 | echo 1159 | echo 1160 | echo 1161 | echo 1162 | echo 1163 | echo 1164 | echo 1165 | echo 1166 | echo 1167 | echo 1168 | echo 1169 | echo 1170 | echo 1171 | echo 1172 | echo 1173 | echo 1174 | echo 1175 | echo 1176 | echo 1177 | echo 1178 | echo 1179 | echo 1180 | echo 1181 | echo 1182 | echo 1183 | echo 1184 | echo 1185 | echo 1186 | echo 1187 | echo 1188 | echo 1189 | echo 1190 | echo 1191 | echo 1192 | echo 1193 | echo 1194 | echo 1195 | echo 1196 | echo 1197 | echo 1198 | echo 1199 | echo 1200 | echo 1201 | echo 1202 | echo 1203 | echo 1204 | echo 1205 | echo 1206 | echo 1207 | echo 1208 | echo 1209 | echo 1210 | echo 1211 | echo 1212 | echo 1213 | echo 1214 | echo 1215 | echo 1216 | echo 1217 | echo 1218 | echo 1219 | echo 1220 | echo 1221 | echo 1222 | echo 1223 | echo 1224 | echo 1225 | echo 1226 | echo 1227 | echo 1228 | echo 1229 | echo 1230 | echo 1231 | echo 1232 | echo 1233 | echo 1234 | echo 1235 | echo 1236 | echo 1237 | echo 1238 | echo 1239 | echo 1240 | echo 1241 | echo 1242 | echo 1243 | echo 1244 | echo 1245 | echo 1246 | echo 1247 | echo 1248 | echo 1249 | echo 1250 | echo 1251 | echo 1252 | echo 1253 | echo 1254 | echo 1255 | echo 1256 | echo 1257 | echo 1258 | echo 1259 | echo 1260 | echo 1261 | echo 1262 | echo 1263 | echo 1264 | echo 1265 | echo 1266 | echo 1267 | echo 1268 | echo 1269 | echo 1270 | echo 1271 | echo 1272 | echo 1273 | echo 1274 | echo 1275 | echo 1276 | echo 1277 | echo 1278 | echo 1279 | echo 1280 | echo 1281 | echo 1282 | echo 1283 | echo 1284 | echo 1285 | echo 1286 | echo 1287 | echo 1288 | echo 1289 | echo 1290 | echo 1291 | echo 1292 | echo 1293 | echo 1294 | echo 1295 | echo 1296 | echo 1297 | echo 1298 | echo 1299 | echo 1300 | echo 1301 | echo 1302 | echo 1303 | echo 1304 | echo 1305 | echo 1306 | echo 1307 | echo 1308 | echo 1309 | echo 1310 | echo 1311 | echo 1312 | echo 1313 | echo 1314 | echo 1315 | echo 1316 | echo 1317 | echo 1318 | echo 1319 | echo 1320 | echo 1321 | echo 1322 | echo 1323 | echo 1324 | echo 1325 | echo 1326 | echo 1327 | echo 1328 | echo 1329 | echo 1330 | echo 1331 | echo 1332 | echo 1333 | echo 1334 | echo 1335 | echo 1336 | echo 1337 | echo 1338 | echo 1339 | echo 1340 | echo 1341 | echo 1342 | echo 1343 | echo 1344 | echo 1345 | echo 1346 | echo 1347 | echo 1348 | echo 1349 | echo 1350 | echo 1351 | echo 1352 | echo 1353 | echo 1354 | echo 1355 | echo 1356 | echo 1357 | echo 1358 | echo 1359 | echo 1360 | echo 1361 | echo 1362 | echo 1363 | echo 1364 | echo 1365 | echo 1366 | echo 1367 | echo 1368 | echo 1369 | echo 1370 | echo 1371 | echo 1372 | echo 1373 | echo 1374 | echo 1375 | echo 1376 | echo 1377 | echo 1378 | echo 1379 | echo 1380 | echo 1381 | echo 1382 | echo 1383 | echo 1384 | echo 1385 | echo 1386 | echo 1387 | echo 1388 | echo 1389 | echo 1390 | echo 1391 | echo 1392 | echo 1393 | echo 1394 | echo 1395 | echo 1396 | echo 1397 | echo 1398 | echo 1399 | echo 1400 | echo 1401 | echo 1402 | echo 1403 | echo 1404 | echo 1405 | echo 1406 | echo 1407 | echo 1408 | echo 1409 | echo 1410 | echo 1411 | echo 1412 | echo 1413 | echo 1414 | echo 1415 | echo 1416 | echo 1417 | echo 1418 | echo 1419 | echo 1420 | echo 1421 | echo 1422 | echo 1423 | echo 1424 | echo 1425 | echo 1426 | echo 1427 | echo 1428 | echo 1429 | echo 1430 | echo 1431 | echo 1432 | echo 1433 | echo 1434 | echo 1435 | echo 1436 | echo 1437 | echo 1438 | echo 1439 | echo 1440 | echo 1441 | echo 1442 | echo 1443 | echo 1444 | echo 1445 | echo 1446 | echo 1447 | echo 1448 | echo 1449 | echo 1450 | echo 1451 | echo 1452 | echo 1453 | echo 1454 | echo 1455 | echo 1456 | echo 1457 | echo 1458 | echo 1459 | echo 1460 | echo 1461 | echo 1462 | echo 1463 | echo 1464 | echo 1465 | echo 1466 | echo 1467 | echo 1468 | echo 1469 | echo 1470 | echo 1471 | echo 1472 | echo 1473 | echo 1474 | echo 1475 | echo 1476 | echo 1477 | echo 1478 | echo 1479 | echo 1480 | echo 1481 | echo 1482 | echo 1483 | echo 1484 | echo 1485 | echo 1486 | echo 1487 | echo 1488 | echo 1489 | echo 1490 | echo 1491 | echo 1492 | echo 1493 | echo 1494 | echo 1495 | echo 1496 | echo 1497 | echo 1498 | echo 1499 | echo 1500 | echo 1501 | echo 1502 | echo 1503 | echo 1504 | echo 1505 | echo 1506 | echo 1507 | echo 1508 | echo 1509 | echo 1510 | echo 1511 | echo 1512 | echo 1513 | echo 1514 | echo 1515 | echo 1516 | echo 1517 | echo 1518 | echo 1519 | echo 1520 | echo 1521 | echo 1522 | echo 1523 | echo 1524 | echo 1525 | echo 1526 | echo 1527 | echo 1528 | echo 1529 | echo 1530 | echo 1531 | echo 1532 | echo 1533 | echo 1534 | echo 1535 | echo 1536 | echo 1537 | echo 1538 | echo 1539 | echo 1540 | echo 1541 | echo 1542 | echo 1543 | echo 1544 | echo 1545 | echo 1546 | echo 1547 | echo 1548 | echo 1549 | echo 1550 | echo 1551 | echo 1552 | echo 1553 | echo 1554 | echo 1555 | echo 1556 | echo 1557 | echo 1558 | echo 1559 | echo 1560 | echo 1561 | echo 1562 | echo 1563 | echo 1564 | echo 1565 | echo 1566 | echo 1567 | echo 1568 | echo 1569 | echo 1570 | echo 1571 | echo 1572 | echo 1573 | echo 1574 | echo 1575 | echo 1576 | echo 1577 | echo 1578 | echo 1579 | echo 1580 | echo 1581 | echo 1582 | echo 1583 | echo 1584 | echo 1585 | echo 1586 | echo 1587 | echo 1588 | echo 1589 | echo 1590 | echo 1591 | echo 1592 | echo 1593 | echo 1594 | echo 1595 | echo 1596 | echo 1597 | echo 1598 | echo 1599 | echo 1600 | echo 1601 | echo 1602 | echo 1603 | echo 1604 | echo 1605 | echo 1606 | echo 1607 | echo 1608 | echo 1609 | echo 1610 | echo 1611 | echo 1612 | echo 1613 | echo 1614 | echo 1615 | echo 1616 | echo 1617 | echo 1618 | echo 1619 | echo 1620 | echo 1621 | echo 1622 | echo 1623 | echo 1624 | echo 1625 | echo 1626 | echo 1627 | echo 1628 | echo 1629 | echo 1630 | echo 1631 | echo 1632 | echo 1633 | echo 1634 | echo 1635 | echo 1636 | echo 1637 | echo 1638 | echo 1639 | echo 1640 | echo 1641 | echo 1642 | echo 1643 | echo 1644 | echo 1645 | echo 1646 | echo 1647 | echo 1648 | echo 1649 | echo 1650 | echo 1651 | echo 1652 | echo 1653 | echo 1654 | echo 1655 | echo 1656 | echo 1657 | echo 1658 | echo 1659 | echo 1660 | echo 1661 | echo 1662 | echo 1663 | echo 1664 | echo 1665 | echo 1666 | echo 1667 | echo 1668 | echo 1669 | echo 1670 | echo 1671 | echo 1672 | echo 1673 | echo 1674 | echo 1675 | echo 1676 | echo 1677 | echo 1678 | echo 1679 | echo 1680 | echo 1681 | echo 1682 | echo 1683 | echo 1684 | echo 1685 | echo 1686 | echo 1687 | echo 1688 | echo 1689 | echo 1690 | echo 1691 | echo 1692 | echo 1693 | echo 1694 | echo 1695 | echo 1696 | echo 1697 | echo 1698 | echo 1699 | echo 1700 | echo 1701 | echo 1702 | echo 1703 | echo 1704 | echo 1705 | echo 1706 | echo 1707 | echo 1708 | echo 1709 | echo 1710 | echo 1711 | echo 1712 | echo 1713 | echo 1714 | echo 1715 | echo 1716 | echo 1717 | echo 1718 | echo 1719 | echo 1720 | echo 1721 | echo 1722 | echo 1723 | echo 1724 | echo 1725 | echo 1726 | echo 1727 | echo 1728 | echo 1729 | echo 1730 | echo 1731 | echo 1732 | echo 1733 | echo 1734 | echo 1735 | echo 1736 | echo 1737 | echo 1738 | echo 1739 | echo 1740 | echo 1741 | echo 1742 | echo 1743 | echo 1744 | echo 1745 | echo 1746 | echo 1747 | echo 1748 | echo 1749 | echo 1750 | echo 1751 | echo 1752 | echo 1753 | echo 1754 | echo 1755 | echo 1756 | echo 1757 | echo 1758 | echo 1759 | echo 1760 | echo 1761 | echo 1762 | echo 1763 | echo 1764 | echo 1765 | echo 1766 | echo 1767 | echo 1768 | echo 1769 | echo 1770 | echo 1771 | echo 1772 | echo 1773 | echo 1774 | echo 1775 | echo 1776 | echo 1777 | echo 1778 | echo 1779 | echo 1780 | echo 1781 | echo 1782 | echo 1783 | echo 1784 | echo 1785 | echo 1786 | echo 1787 | echo 1788 | echo 1789 | echo 1790 | echo 1791 | echo 1792 | echo 1793 | echo 1794 | echo 1795 | echo 1796 | echo 1797 | echo 1798 | echo 1799 | echo 1800 | echo 1801 | echo 1802 | echo 1803 | echo 1804 | echo 1805 | echo 1806 | echo 1807 | echo 1808 | echo 1809 | echo 1810 | echo 1811 | echo 1812 | echo 1813 | echo 1814 | echo 1815 | echo 1816 | echo 1817 | echo 1818 | echo 1819 | echo 1820 | echo 1821 | echo 1822 | echo 1823 | echo 1824 | echo 1825 | echo 1826 | echo 1827 | echo 1828 | echo 1829 | echo 1830 | echo 1831 | echo 1832 | echo 1833 | echo 1834 | echo 1835 | echo 1836 | echo 1837 | echo 1838 | echo 1839 | echo 1840 | echo 1841 | echo 1842 | echo 1843 | echo 1844 | echo 1845 | echo 1846 | echo 1847 | echo 1848 | echo 1849 | echo 1850 | echo 1851 | echo 1852 | echo 1853 | echo 1854 | echo 1855 | echo 1856 | echo 1857 | echo 1858 | echo 1859 | echo 1860 | echo 1861 | echo 1862 | echo 1863 | echo 1864 | echo 1865 | echo 1866 | echo 1867 | echo 1868 | echo 1869 | echo 1870 | echo 1871 | echo 1872 | echo 1873 | echo 1874 | echo 1875 | echo 1876 | echo 1877 | echo 1878 | echo 1879 | echo 1880 | echo 1881 | echo 1882 | echo 1883 | echo 1884 | echo 1885 | echo 1886 | echo 1887 | echo 1888 | echo 1889 | echo 1890 | echo 1891 | echo 1892 | echo 1893 | echo 1894 | echo 1895 | echo 1896 | echo 1897 | echo 1898 | echo 1899 | echo 1900 | echo 1901 | echo 1902 | echo 1903 | echo 1904 | echo 1905 | echo 1906 | echo 1907 | echo 1908 | echo 1909 | echo 1910 | echo 1911 | echo 1912 | echo 1913 | echo 1914 | echo 1915 | echo 1916 | echo 1917 | echo 1918 | echo 1919 | echo 1920 | echo 1921 | echo 1922 | echo 1923 | echo 1924 | echo 1925 | echo 1926 | echo 1927 | echo 1928 | echo 1929 | echo 1930 | echo 1931 | echo 1932 | echo 1933 | echo 1934 | echo 1935 | echo 1936 | echo 1937 | echo 1938 | echo 1939 | echo 1940 | echo 1941 | echo 1942 | echo 1943 | echo 1944 | echo 1945 | echo 1946 | echo 1947 | echo 1948 | echo 1949 | echo 1950 | echo 1951 | echo 1952 | echo 1953 | echo 1954 | echo 1955 | echo 1956 | echo 1957 | echo 1958 | echo 1959 | echo 1960 | echo 1961 | echo 1962 | echo 1963 | echo 1964 | echo 1965 | echo 1966 | echo 1967 | echo 1968 | echo 1969 | echo 1970 | echo 1971 | echo 1972 | echo 1973 | echo 1974 | echo 1975 | echo 1976 | echo 1977 | echo 1978 | echo 1979 | echo 1980 | echo 1981 | echo 1982 | echo 1983 | echo 1984 | echo 1985 | echo 1986 | echo 1987 | echo 1988 | echo 1989 | echo 1990 | echo 1991 | echo 1992 | echo 1993 | echo 1994 | echo 1995 | echo 1996 | echo 1997 | echo 1998 | echo 1999
+nnoremap <leader>x :call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>:call Foo()<CR>
+var total = 0 + 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11 + 12 + 13 + 14 + 15 + 16 + 17 + 18 + 19 + 20 + 21 + 22 + 23 + 24 + 25 + 26 + 27 + 28 + 29 + 30 + 31 + 32 + 33 + 34 + 35 + 36 + 37 + 38 + 39 + 40 + 41 + 42 + 43 + 44 + 45 + 46 + 47 + 48 + 49 + 50 + 51 + 52 + 53 + 54 + 55 + 56 + 57 + 58 + 59 + 60 + 61 + 62 + 63 + 64 + 65 + 66 + 67 + 68 + 69 + 70 + 71 + 72 + 73 + 74 + 75 + 76 + 77 + 78 + 79 + 80 + 81 + 82 + 83 + 84 + 85 + 86 + 87 + 88 + 89 + 90 + 91 + 92 + 93 + 94 + 95 + 96 + 97 + 98 + 99 + 100 + 101 + 102 + 103 + 104 + 105 + 106 + 107 + 108 + 109 + 110 + 111 + 112 + 113 + 114 + 115 + 116 + 117 + 118 + 119 + 120 + 121 + 122 + 123 + 124 + 125 + 126 + 127 + 128 + 129 + 130 + 131 + 132 + 133 + 134 + 135 + 136 + 137 + 138 + 139 + 140 + 141 + 142 + 143 + 144 + 145 + 146 + 147 + 148 + 149 + 150 + 151 + 152 + 153 + 154 + 155 + 156 + 157 + 158 + 159 + 160 + 161 + 162 + 163 + 164 + 165 + 166 + 167 + 168 + 169 + 170 + 171 + 172 + 173 + 174 + 175 + 176 + 177 + 178 + 179 + 180 + 181 + 182 + 183 + 184 + 185 + 186 + 187 + 188 + 189 + 190 + 191 + 192 + 193 + 194 + 195 + 196 + 197 + 198 + 199 + 200 + 201 + 202 + 203 + 204 + 205 + 206 + 207 + 208 + 209 + 210 + 211 + 212 + 213 + 214 + 215 + 216 + 217 + 218 + 219 + 220 + 221 + 222 + 223 + 224 + 225 + 226 + 227 + 228 + 229 + 230 + 231 + 232 + 233 + 234 + 235 + 236 + 237 + 238 + 239 + 240 + 241 + 242 + 243 + 244 + 245 + 246 + 247 + 248 + 249 + 250 + 251 + 252 + 253 + 254 + 255 + 256 + 257 + 258 + 259 + 260 + 261 + 262 + 263 + 264 + 265 + 266 + 267 + 268 + 269 + 270 + 271 + 272 + 273 + 274 + 275 + 276 + 277 + 278 + 279 + 280 + 281 + 282 + 283 + 284 + 285 + 286 + 287 + 288 + 289 + 290 + 291 + 292 + 293 + 294 + 295 + 296 + 297 + 298 + 299 + 300 + 301 + 302 + 303 + 304 + 305 + 306 + 307 + 308 + 309 + 310 + 311 + 312 + 313 + 314 + 315 + 316 + 317 + 318 + 319 + 320 + 321 + 322 + 323 + 324 + 325 + 326 + 327 + 328 + 329 + 330 + 331 + 332 + 333 + 334 + 335 + 336 + 337 + 338 + 339 + 340 + 341 + 342 + 343 + 344 + 345 + 346 + 347 + 348 + 349 + 350 + 351 + 352 + 353 + 354 + 355 + 356 + 357 + 358 + 359 + 360 + 361 + 362 + 363 + 364 + 365 + 366 + 367 + 368 + 369 + 370 + 371 + 372 + 373 + 374 + 375 + 376 + 377 + 378 + 379 + 380 + 381 + 382 + 383 + 384 + 385 + 386 + 387 + 388 + 389 + 390 + 391 + 392 + 393 + 394 + 395 + 396 + 397 + 398 + 399
+inoremap <buffer> k0 <C-o>:echo 0<CR>
+inoremap <buffer> k1 <C-o>:echo 1<CR>
+inoremap <buffer> k2 <C-o>:echo 2<CR>
+inoremap <buffer> k3 <C-o>:echo 3<CR>
+inoremap <buffer> k4 <C-o>:echo 4<CR>
+inoremap <buffer> k5 <C-o>:echo 5<CR>
+inoremap <buffer> k6 <C-o>:echo 6<CR>
+inoremap <buffer> k7 <C-o>:echo 7<CR>
+inoremap <buffer> k8 <C-o>:echo 8<CR>
+inoremap <buffer> k9 <C-o>:echo 9<CR>
+inoremap <buffer> k10 <C-o>:echo 10<CR>
+inoremap <buffer> k11 <C-o>:echo 11<CR>
+inoremap <buffer> k12 <C-o>:echo 12<CR>
+inoremap <buffer> k13 <C-o>:echo 13<CR>
+inoremap <buffer> k14 <C-o>:echo 14<CR>
+inoremap <buffer> k15 <C-o>:echo 15<CR>
+inoremap <buffer> k16 <C-o>:echo 16<CR>
+inoremap <buffer> k17 <C-o>:echo 17<CR>
+inoremap <buffer> k18 <C-o>:echo 18<CR>
+inoremap <buffer> k19 <C-o>:echo 19<CR>
+inoremap <buffer> k20 <C-o>:echo 20<CR>
+inoremap <buffer> k21 <C-o>:echo 21<CR>
+inoremap <buffer> k22 <C-o>:echo 22<CR>
+inoremap <buffer> k23 <C-o>:echo 23<CR>
+inoremap <buffer> k24 <C-o>:echo 24<CR>
+inoremap <buffer> k25 <C-o>:echo 25<CR>
+inoremap <buffer> k26 <C-o>:echo 26<CR>
+inoremap <buffer> k27 <C-o>:echo 27<CR>
+inoremap <buffer> k28 <C-o>:echo 28<CR>
+inoremap <buffer> k29 <C-o>:echo 29<CR>
+inoremap <buffer> k30 <C-o>:echo 30<CR>
+inoremap <buffer> k31 <C-o>:echo 31<CR>
+inoremap <buffer> k32 <C-o>:echo 32<CR>
+inoremap <buffer> k33 <C-o>:echo 33<CR>
+inoremap <buffer> k34 <C-o>:echo 34<CR>
+inoremap <buffer> k35 <C-o>:echo 35<CR>
+inoremap <buffer> k36 <C-o>:echo 36<CR>
+inoremap <buffer> k37 <C-o>:echo 37<CR>
+inoremap <buffer> k38 <C-o>:echo 38<CR>
+inoremap <buffer> k39 <C-o>:echo 39<CR>
+inoremap <buffer> k40 <C-o>:echo 40<CR>
+inoremap <buffer> k41 <C-o>:echo 41<CR>
+inoremap <buffer> k42 <C-o>:echo 42<CR>
+inoremap <buffer> k43 <C-o>:echo 43<CR>
+inoremap <buffer> k44 <C-o>:echo 44<CR>
+inoremap <buffer> k45 <C-o>:echo 45<CR>
+inoremap <buffer> k46 <C-o>:echo 46<CR>
+inoremap <buffer> k47 <C-o>:echo 47<CR>
+inoremap <buffer> k48 <C-o>:echo 48<CR>
+inoremap <buffer> k49 <C-o>:echo 49<CR>
+inoremap <buffer> k50 <C-o>:echo 50<CR>
+inoremap <buffer> k51 <C-o>:echo 51<CR>
+inoremap <buffer> k52 <C-o>:echo 52<CR>
+inoremap <buffer> k53 <C-o>:echo 53<CR>
+inoremap <buffer> k54 <C-o>:echo 54<CR>
+inoremap <buffer> k55 <C-o>:echo 55<CR>
+inoremap <buffer> k56 <C-o>:echo 56<CR>
+inoremap <buffer> k57 <C-o>:echo 57<CR>
+inoremap <buffer> k58 <C-o>:echo 58<CR>
+inoremap <buffer> k59 <C-o>:echo 59<CR>
+inoremap <buffer> k60 <C-o>:echo 60<CR>
+inoremap <buffer> k61 <C-o>:echo 61<CR>
+inoremap <buffer> k62 <C-o>:echo 62<CR>
+inoremap <buffer> k63 <C-o>:echo 63<CR>
+inoremap <buffer> k64 <C-o>:echo 64<CR>
+inoremap <buffer> k65 <C-o>:echo 65<CR>
+inoremap <buffer> k66 <C-o>:echo 66<CR>
+inoremap <buffer> k67 <C-o>:echo 67<CR>
+inoremap <buffer> k68 <C-o>:echo 68<CR>
+inoremap <buffer> k69 <C-o>:echo 69<CR>
+inoremap <buffer> k70 <C-o>:echo 70<CR>
+inoremap <buffer> k71 <C-o>:echo 71<CR>
+inoremap <buffer> k72 <C-o>:echo 72<CR>
+inoremap <buffer> k73 <C-o>:echo 73<CR>
+inoremap <buffer> k74 <C-o>:echo 74<CR>
+inoremap <buffer> k75 <C-o>:echo 75<CR>
+inoremap <buffer> k76 <C-o>:echo 76<CR>
+inoremap <buffer> k77 <C-o>:echo 77<CR>
+inoremap <buffer> k78 <C-o>:echo 78<CR>
+inoremap <buffer> k79 <C-o>:echo 79<CR>
+inoremap <buffer> k80 <C-o>:echo 80<CR>
+inoremap <buffer> k81 <C-o>:echo 81<CR>
+inoremap <buffer> k82 <C-o>:echo 82<CR>
+inoremap <buffer> k83 <C-o>:echo 83<CR>
+inoremap <buffer> k84 <C-o>:echo 84<CR>
+inoremap <buffer> k85 <C-o>:echo 85<CR>
+inoremap <buffer> k86 <C-o>:echo 86<CR>
+inoremap <buffer> k87 <C-o>:echo 87<CR>
+inoremap <buffer> k88 <C-o>:echo 88<CR>
+inoremap <buffer> k89 <C-o>:echo 89<CR>
+inoremap <buffer> k90 <C-o>:echo 90<CR>
+inoremap <buffer> k91 <C-o>:echo 91<CR>
+inoremap <buffer> k92 <C-o>:echo 92<CR>
+inoremap <buffer> k93 <C-o>:echo 93<CR>
+inoremap <buffer> k94 <C-o>:echo 94<CR>
+inoremap <buffer> k95 <C-o>:echo 95<CR>
+inoremap <buffer> k96 <C-o>:echo 96<CR>
+inoremap <buffer> k97 <C-o>:echo 97<CR>
+inoremap <buffer> k98 <C-o>:echo 98<CR>
+inoremap <buffer> k99 <C-o>:echo 99<CR>
+inoremap <buffer> k100 <C-o>:echo 100<CR>
+inoremap <buffer> k101 <C-o>:echo 101<CR>
+inoremap <buffer> k102 <C-o>:echo 102<CR>
+inoremap <buffer> k103 <C-o>:echo 103<CR>
+inoremap <buffer> k104 <C-o>:echo 104<CR>
+inoremap <buffer> k105 <C-o>:echo 105<CR>
+inoremap <buffer> k106 <C-o>:echo 106<CR>
+inoremap <buffer> k107 <C-o>:echo 107<CR>
+inoremap <buffer> k108 <C-o>:echo 108<CR>
+inoremap <buffer> k109 <C-o>:echo 109<CR>
+inoremap <buffer> k110 <C-o>:echo 110<CR>
+inoremap <buffer> k111 <C-o>:echo 111<CR>
+inoremap <buffer> k112 <C-o>:echo 112<CR>
+inoremap <buffer> k113 <C-o>:echo 113<CR>
+inoremap <buffer> k114 <C-o>:echo 114<CR>
+inoremap <buffer> k115 <C-o>:echo 115<CR>
+inoremap <buffer> k116 <C-o>:echo 116<CR>
+inoremap <buffer> k117 <C-o>:echo 117<CR>
+inoremap <buffer> k118 <C-o>:echo 118<CR>
+inoremap <buffer> k119 <C-o>:echo 119<CR>
+inoremap <buffer> k120 <C-o>:echo 120<CR>
+inoremap <buffer> k121 <C-o>:echo 121<CR>
+inoremap <buffer> k122 <C-o>:echo 122<CR>
+inoremap <buffer> k123 <C-o>:echo 123<CR>
+inoremap <buffer> k124 <C-o>:echo 124<CR>
+inoremap <buffer> k125 <C-o>:echo 125<CR>
+inoremap <buffer> k126 <C-o>:echo 126<CR>
+inoremap <buffer> k127 <C-o>:echo 127<CR>
+inoremap <buffer> k128 <C-o>:echo 128<CR>
+inoremap <buffer> k129 <C-o>:echo 129<CR>
+inoremap <buffer> k130 <C-o>:echo 130<CR>
+inoremap <buffer> k131 <C-o>:echo 131<CR>
+inoremap <buffer> k132 <C-o>:echo 132<CR>
+inoremap <buffer> k133 <C-o>:echo 133<CR>
+inoremap <buffer> k134 <C-o>:echo 134<CR>
+inoremap <buffer> k135 <C-o>:echo 135<CR>
+inoremap <buffer> k136 <C-o>:echo 136<CR>
+inoremap <buffer> k137 <C-o>:echo 137<CR>
+inoremap <buffer> k138 <C-o>:echo 138<CR>
+inoremap <buffer> k139 <C-o>:echo 139<CR>
+inoremap <buffer> k140 <C-o>:echo 140<CR>
+inoremap <buffer> k141 <C-o>:echo 141<CR>
+inoremap <buffer> k142 <C-o>:echo 142<CR>
+inoremap <buffer> k143 <C-o>:echo 143<CR>
+inoremap <buffer> k144 <C-o>:echo 144<CR>
+inoremap <buffer> k145 <C-o>:echo 145<CR>
+inoremap <buffer> k146 <C-o>:echo 146<CR>
+inoremap <buffer> k147 <C-o>:echo 147<CR>
+inoremap <buffer> k148 <C-o>:echo 148<CR>
+inoremap <buffer> k149 <C-o>:echo 149<CR>
+inoremap <buffer> k150 <C-o>:echo 150<CR>
+inoremap <buffer> k151 <C-o>:echo 151<CR>
+inoremap <buffer> k152 <C-o>:echo 152<CR>
+inoremap <buffer> k153 <C-o>:echo 153<CR>
+inoremap <buffer> k154 <C-o>:echo 154<CR>
+inoremap <buffer> k155 <C-o>:echo 155<CR>
+inoremap <buffer> k156 <C-o>:echo 156<CR>
+inoremap <buffer> k157 <C-o>:echo 157<CR>
+inoremap <buffer> k158 <C-o>:echo 158<CR>
+inoremap <buffer> k159 <C-o>:echo 159<CR>
+inoremap <buffer> k160 <C-o>:echo 160<CR>
+inoremap <buffer> k161 <C-o>:echo 161<CR>
+inoremap <buffer> k162 <C-o>:echo 162<CR>
+inoremap <buffer> k163 <C-o>:echo 163<CR>
+inoremap <buffer> k164 <C-o>:echo 164<CR>
+inoremap <buffer> k165 <C-o>:echo 165<CR>
+inoremap <buffer> k166 <C-o>:echo 166<CR>
+inoremap <buffer> k167 <C-o>:echo 167<CR>
+inoremap <buffer> k168 <C-o>:echo 168<CR>
+inoremap <buffer> k169 <C-o>:echo 169<CR>
+inoremap <buffer> k170 <C-o>:echo 170<CR>
+inoremap <buffer> k171 <C-o>:echo 171<CR>
+inoremap <buffer> k172 <C-o>:echo 172<CR>
+inoremap <buffer> k173 <C-o>:echo 173<CR>
+inoremap <buffer> k174 <C-o>:echo 174<CR>
+inoremap <buffer> k175 <C-o>:echo 175<CR>
+inoremap <buffer> k176 <C-o>:echo 176<CR>
+inoremap <buffer> k177 <C-o>:echo 177<CR>
+inoremap <buffer> k178 <C-o>:echo 178<CR>
+inoremap <buffer> k179 <C-o>:echo 179<CR>
+inoremap <buffer> k180 <C-o>:echo 180<CR>
+inoremap <buffer> k181 <C-o>:echo 181<CR>
+inoremap <buffer> k182 <C-o>:echo 182<CR>
+inoremap <buffer> k183 <C-o>:echo 183<CR>
+inoremap <buffer> k184 <C-o>:echo 184<CR>
+inoremap <buffer> k185 <C-o>:echo 185<CR>
+inoremap <buffer> k186 <C-o>:echo 186<CR>
+inoremap <buffer> k187 <C-o>:echo 187<CR>
+inoremap <buffer> k188 <C-o>:echo 188<CR>
+inoremap <buffer> k189 <C-o>:echo 189<CR>
+inoremap <buffer> k190 <C-o>:echo 190<CR>
+inoremap <buffer> k191 <C-o>:echo 191<CR>
+inoremap <buffer> k192 <C-o>:echo 192<CR>
+inoremap <buffer> k193 <C-o>:echo 193<CR>
+inoremap <buffer> k194 <C-o>:echo 194<CR>
+inoremap <buffer> k195 <C-o>:echo 195<CR>
+inoremap <buffer> k196 <C-o>:echo 196<CR>
+inoremap <buffer> k197 <C-o>:echo 197<CR>
+inoremap <buffer> k198 <C-o>:echo 198<CR>
+inoremap <buffer> k199 <C-o>:echo 199<CR>
+inoremap <buffer> k200 <C-o>:echo 200<CR>
+inoremap <buffer> k201 <C-o>:echo 201<CR>
+inoremap <buffer> k202 <C-o>:echo 202<CR>
+inoremap <buffer> k203 <C-o>:echo 203<CR>
+inoremap <buffer> k204 <C-o>:echo 204<CR>
+inoremap <buffer> k205 <C-o>:echo 205<CR>
+inoremap <buffer> k206 <C-o>:echo 206<CR>
+inoremap <buffer> k207 <C-o>:echo 207<CR>
+inoremap <buffer> k208 <C-o>:echo 208<CR>
+inoremap <buffer> k209 <C-o>:echo 209<CR>
+inoremap <buffer> k210 <C-o>:echo 210<CR>
+inoremap <buffer> k211 <C-o>:echo 211<CR>
+inoremap <buffer> k212 <C-o>:echo 212<CR>
+inoremap <buffer> k213 <C-o>:echo 213<CR>
+inoremap <buffer> k214 <C-o>:echo 214<CR>
+inoremap <buffer> k215 <C-o>:echo 215<CR>
+inoremap <buffer> k216 <C-o>:echo 216<CR>
+inoremap <buffer> k217 <C-o>:echo 217<CR>
+inoremap <buffer> k218 <C-o>:echo 218<CR>
+inoremap <buffer> k219 <C-o>:echo 219<CR>
+inoremap <buffer> k220 <C-o>:echo 220<CR>
+inoremap <buffer> k221 <C-o>:echo 221<CR>
+inoremap <buffer> k222 <C-o>:echo 222<CR>
+inoremap <buffer> k223 <C-o>:echo 223<CR>
+inoremap <buffer> k224 <C-o>:echo 224<CR>
+inoremap <buffer> k225 <C-o>:echo 225<CR>
+inoremap <buffer> k226 <C-o>:echo 226<CR>
+inoremap <buffer> k227 <C-o>:echo 227<CR>
+inoremap <buffer> k228 <C-o>:echo 228<CR>
+inoremap <buffer> k229 <C-o>:echo 229<CR>
+inoremap <buffer> k230 <C-o>:echo 230<CR>
+inoremap <buffer> k231 <C-o>:echo 231<CR>
+inoremap <buffer> k232 <C-o>:echo 232<CR>
+inoremap <buffer> k233 <C-o>:echo 233<CR>
+inoremap <buffer> k234 <C-o>:echo 234<CR>
+inoremap <buffer> k235 <C-o>:echo 235<CR>
+inoremap <buffer> k236 <C-o>:echo 236<CR>
+inoremap <buffer> k237 <C-o>:echo 237<CR>
+inoremap <buffer> k238 <C-o>:echo 238<CR>
+inoremap <buffer> k239 <C-o>:echo 239<CR>
+inoremap <buffer> k240 <C-o>:echo 240<CR>
+inoremap <buffer> k241 <C-o>:echo 241<CR>
+inoremap <buffer> k242 <C-o>:echo 242<CR>
+inoremap <buffer> k243 <C-o>:echo 243<CR>
+inoremap <buffer> k244 <C-o>:echo 244<CR>
+inoremap <buffer> k245 <C-o>:echo 245<CR>
+inoremap <buffer> k246 <C-o>:echo 246<CR>
+inoremap <buffer> k247 <C-o>:echo 247<CR>
+inoremap <buffer> k248 <C-o>:echo 248<CR>
+inoremap <buffer> k249 <C-o>:echo 249<CR>
+inoremap <buffer> k250 <C-o>:echo 250<CR>
+inoremap <buffer> k251 <C-o>:echo 251<CR>
+inoremap <buffer> k252 <C-o>:echo 252<CR>
+inoremap <buffer> k253 <C-o>:echo 253<CR>
+inoremap <buffer> k254 <C-o>:echo 254<CR>
+inoremap <buffer> k255 <C-o>:echo 255<CR>
+inoremap <buffer> k256 <C-o>:echo 256<CR>
+inoremap <buffer> k257 <C-o>:echo 257<CR>
+inoremap <buffer> k258 <C-o>:echo 258<CR>
+inoremap <buffer> k259 <C-o>:echo 259<CR>
+inoremap <buffer> k260 <C-o>:echo 260<CR>
+inoremap <buffer> k261 <C-o>:echo 261<CR>
+inoremap <buffer> k262 <C-o>:echo 262<CR>
+inoremap <buffer> k263 <C-o>:echo 263<CR>
+inoremap <buffer> k264 <C-o>:echo 264<CR>
+inoremap <buffer> k265 <C-o>:echo 265<CR>
+inoremap <buffer> k266 <C-o>:echo 266<CR>
+inoremap <buffer> k267 <C-o>:echo 267<CR>
+inoremap <buffer> k268 <C-o>:echo 268<CR>
+inoremap <buffer> k269 <C-o>:echo 269<CR>
+inoremap <buffer> k270 <C-o>:echo 270<CR>
+inoremap <buffer> k271 <C-o>:echo 271<CR>
+inoremap <buffer> k272 <C-o>:echo 272<CR>
+inoremap <buffer> k273 <C-o>:echo 273<CR>
+inoremap <buffer> k274 <C-o>:echo 274<CR>
+inoremap <buffer> k275 <C-o>:echo 275<CR>
+inoremap <buffer> k276 <C-o>:echo 276<CR>
+inoremap <buffer> k277 <C-o>:echo 277<CR>
+inoremap <buffer> k278 <C-o>:echo 278<CR>
+inoremap <buffer> k279 <C-o>:echo 279<CR>
+inoremap <buffer> k280 <C-o>:echo 280<CR>
+inoremap <buffer> k281 <C-o>:echo 281<CR>
+inoremap <buffer> k282 <C-o>:echo 282<CR>
+inoremap <buffer> k283 <C-o>:echo 283<CR>
+inoremap <buffer> k284 <C-o>:echo 284<CR>
+inoremap <buffer> k285 <C-o>:echo 285<CR>
+inoremap <buffer> k286 <C-o>:echo 286<CR>
+inoremap <buffer> k287 <C-o>:echo 287<CR>
+inoremap <buffer> k288 <C-o>:echo 288<CR>
+inoremap <buffer> k289 <C-o>:echo 289<CR>
+inoremap <buffer> k290 <C-o>:echo 290<CR>
+inoremap <buffer> k291 <C-o>:echo 291<CR>
+inoremap <buffer> k292 <C-o>:echo 292<CR>
+inoremap <buffer> k293 <C-o>:echo 293<CR>
+inoremap <buffer> k294 <C-o>:echo 294<CR>
+inoremap <buffer> k295 <C-o>:echo 295<CR>
+inoremap <buffer> k296 <C-o>:echo 296<CR>
+inoremap <buffer> k297 <C-o>:echo 297<CR>
+inoremap <buffer> k298 <C-o>:echo 298<CR>
+inoremap <buffer> k299 <C-o>:echo 299<CR>
+inoremap <buffer> k300 <C-o>:echo 300<CR>
+inoremap <buffer> k301 <C-o>:echo 301<CR>
+inoremap <buffer> k302 <C-o>:echo 302<CR>
+inoremap <buffer> k303 <C-o>:echo 303<CR>
+inoremap <buffer> k304 <C-o>:echo 304<CR>
+inoremap <buffer> k305 <C-o>:echo 305<CR>
+inoremap <buffer> k306 <C-o>:echo 306<CR>
+inoremap <buffer> k307 <C-o>:echo 307<CR>
+inoremap <buffer> k308 <C-o>:echo 308<CR>
+inoremap <buffer> k309 <C-o>:echo 309<CR>
+inoremap <buffer> k310 <C-o>:echo 310<CR>
+inoremap <buffer> k311 <C-o>:echo 311<CR>
+inoremap <buffer> k312 <C-o>:echo 312<CR>
+inoremap <buffer> k313 <C-o>:echo 313<CR>
+inoremap <buffer> k314 <C-o>:echo 314<CR>
+inoremap <buffer> k315 <C-o>:echo 315<CR>
+inoremap <buffer> k316 <C-o>:echo 316<CR>
+inoremap <buffer> k317 <C-o>:echo 317<CR>
+inoremap <buffer> k318 <C-o>:echo 318<CR>
+inoremap <buffer> k319 <C-o>:echo 319<CR>
+inoremap <buffer> k320 <C-o>:echo 320<CR>
+inoremap <buffer> k321 <C-o>:echo 321<CR>
+inoremap <buffer> k322 <C-o>:echo 322<CR>
+inoremap <buffer> k323 <C-o>:echo 323<CR>
+inoremap <buffer> k324 <C-o>:echo 324<CR>
+inoremap <buffer> k325 <C-o>:echo 325<CR>
+inoremap <buffer> k326 <C-o>:echo 326<CR>
+inoremap <buffer> k327 <C-o>:echo 327<CR>
+inoremap <buffer> k328 <C-o>:echo 328<CR>
+inoremap <buffer> k329 <C-o>:echo 329<CR>
+inoremap <buffer> k330 <C-o>:echo 330<CR>
+inoremap <buffer> k331 <C-o>:echo 331<CR>
+inoremap <buffer> k332 <C-o>:echo 332<CR>
+inoremap <buffer> k333 <C-o>:echo 333<CR>
+inoremap <buffer> k334 <C-o>:echo 334<CR>
+inoremap <buffer> k335 <C-o>:echo 335<CR>
+inoremap <buffer> k336 <C-o>:echo 336<CR>
+inoremap <buffer> k337 <C-o>:echo 337<CR>
+inoremap <buffer> k338 <C-o>:echo 338<CR>
+inoremap <buffer> k339 <C-o>:echo 339<CR>
+inoremap <buffer> k340 <C-o>:echo 340<CR>
+inoremap <buffer> k341 <C-o>:echo 341<CR>
+inoremap <buffer> k342 <C-o>:echo 342<CR>
+inoremap <buffer> k343 <C-o>:echo 343<CR>
+inoremap <buffer> k344 <C-o>:echo 344<CR>
+inoremap <buffer> k345 <C-o>:echo 345<CR>
+inoremap <buffer> k346 <C-o>:echo 346<CR>
+inoremap <buffer> k347 <C-o>:echo 347<CR>
+inoremap <buffer> k348 <C-o>:echo 348<CR>
+inoremap <buffer> k349 <C-o>:echo 349<CR>
+inoremap <buffer> k350 <C-o>:echo 350<CR>
+inoremap <buffer> k351 <C-o>:echo 351<CR>
+inoremap <buffer> k352 <C-o>:echo 352<CR>
+inoremap <buffer> k353 <C-o>:echo 353<CR>
+inoremap <buffer> k354 <C-o>:echo 354<CR>
+inoremap <buffer> k355 <C-o>:echo 355<CR>
+inoremap <buffer> k356 <C-o>:echo 356<CR>
+inoremap <buffer> k357 <C-o>:echo 357<CR>
+inoremap <buffer> k358 <C-o>:echo 358<CR>
+inoremap <buffer> k359 <C-o>:echo 359<CR>
+inoremap <buffer> k360 <C-o>:echo 360<CR>
+inoremap <buffer> k361 <C-o>:echo 361<CR>
+inoremap <buffer> k362 <C-o>:echo 362<CR>
+inoremap <buffer> k363 <C-o>:echo 363<CR>
+inoremap <buffer> k364 <C-o>:echo 364<CR>
+inoremap <buffer> k365 <C-o>:echo 365<CR>
+inoremap <buffer> k366 <C-o>:echo 366<CR>
+inoremap <buffer> k367 <C-o>:echo 367<CR>
+inoremap <buffer> k368 <C-o>:echo 368<CR>
+inoremap <buffer> k369 <C-o>:echo 369<CR>
+inoremap <buffer> k370 <C-o>:echo 370<CR>
+inoremap <buffer> k371 <C-o>:echo 371<CR>
+inoremap <buffer> k372 <C-o>:echo 372<CR>
+inoremap <buffer> k373 <C-o>:echo 373<CR>
+inoremap <buffer> k374 <C-o>:echo 374<CR>
+inoremap <buffer> k375 <C-o>:echo 375<CR>
+inoremap <buffer> k376 <C-o>:echo 376<CR>
+inoremap <buffer> k377 <C-o>:echo 377<CR>
+inoremap <buffer> k378 <C-o>:echo 378<CR>
+inoremap <buffer> k379 <C-o>:echo 379<CR>
+inoremap <buffer> k380 <C-o>:echo 380<CR>
+inoremap <buffer> k381 <C-o>:echo 381<CR>
+inoremap <buffer> k382 <C-o>:echo 382<CR>
+inoremap <buffer> k383 <C-o>:echo 383<CR>
+inoremap <buffer> k384 <C-o>:echo 384<CR>
+inoremap <buffer> k385 <C-o>:echo 385<CR>
+inoremap <buffer> k386 <C-o>:echo 386<CR>
+inoremap <buffer> k387 <C-o>:echo 387<CR>
+inoremap <buffer> k388 <C-o>:echo 388<CR>
+inoremap <buffer> k389 <C-o>:echo 389<CR>
+inoremap <buffer> k390 <C-o>:echo 390<CR>
+inoremap <buffer> k391 <C-o>:echo 391<CR>
+inoremap <buffer> k392 <C-o>:echo 392<CR>
+inoremap <buffer> k393 <C-o>:echo 393<CR>
+inoremap <buffer> k394 <C-o>:echo 394<CR>
+inoremap <buffer> k395 <C-o>:echo 395<CR>
+inoremap <buffer> k396 <C-o>:echo 396<CR>
+inoremap <buffer> k397 <C-o>:echo 397<CR>
+inoremap <buffer> k398 <C-o>:echo 398<CR>
+inoremap <buffer> k399 <C-o>:echo 399<CR>
+inoremap <buffer> k400 <C-o>:echo 400<CR>
+inoremap <buffer> k401 <C-o>:echo 401<CR>
+inoremap <buffer> k402 <C-o>:echo 402<CR>
+inoremap <buffer> k403 <C-o>:echo 403<CR>
+inoremap <buffer> k404 <C-o>:echo 404<CR>
+inoremap <buffer> k405 <C-o>:echo 405<CR>
+inoremap <buffer> k406 <C-o>:echo 406<CR>
+inoremap <buffer> k407 <C-o>:echo 407<CR>
+inoremap <buffer> k408 <C-o>:echo 408<CR>
+inoremap <buffer> k409 <C-o>:echo 409<CR>
+inoremap <buffer> k410 <C-o>:echo 410<CR>
+inoremap <buffer> k411 <C-o>:echo 411<CR>
+inoremap <buffer> k412 <C-o>:echo 412<CR>
+inoremap <buffer> k413 <C-o>:echo 413<CR>
+inoremap <buffer> k414 <C-o>:echo 414<CR>
+inoremap <buffer> k415 <C-o>:echo 415<CR>
+inoremap <buffer> k416 <C-o>:echo 416<CR>
+inoremap <buffer> k417 <C-o>:echo 417<CR>
+inoremap <buffer> k418 <C-o>:echo 418<CR>
+inoremap <buffer> k419 <C-o>:echo 419<CR>
+inoremap <buffer> k420 <C-o>:echo 420<CR>
+inoremap <buffer> k421 <C-o>:echo 421<CR>
+inoremap <buffer> k422 <C-o>:echo 422<CR>
+inoremap <buffer> k423 <C-o>:echo 423<CR>
+inoremap <buffer> k424 <C-o>:echo 424<CR>
+inoremap <buffer> k425 <C-o>:echo 425<CR>
+inoremap <buffer> k426 <C-o>:echo 426<CR>
+inoremap <buffer> k427 <C-o>:echo 427<CR>
+inoremap <buffer> k428 <C-o>:echo 428<CR>
+inoremap <buffer> k429 <C-o>:echo 429<CR>
+inoremap <buffer> k430 <C-o>:echo 430<CR>
+inoremap <buffer> k431 <C-o>:echo 431<CR>
+inoremap <buffer> k432 <C-o>:echo 432<CR>
+inoremap <buffer> k433 <C-o>:echo 433<CR>
+inoremap <buffer> k434 <C-o>:echo 434<CR>
+inoremap <buffer> k435 <C-o>:echo 435<CR>
+inoremap <buffer> k436 <C-o>:echo 436<CR>
+inoremap <buffer> k437 <C-o>:echo 437<CR>
+inoremap <buffer> k438 <C-o>:echo 438<CR>
+inoremap <buffer> k439 <C-o>:echo 439<CR>
+inoremap <buffer> k440 <C-o>:echo 440<CR>
+inoremap <buffer> k441 <C-o>:echo 441<CR>
+inoremap <buffer> k442 <C-o>:echo 442<CR>
+inoremap <buffer> k443 <C-o>:echo 443<CR>
+inoremap <buffer> k444 <C-o>:echo 444<CR>
+inoremap <buffer> k445 <C-o>:echo 445<CR>
+inoremap <buffer> k446 <C-o>:echo 446<CR>
+inoremap <buffer> k447 <C-o>:echo 447<CR>
+inoremap <buffer> k448 <C-o>:echo 448<CR>
+inoremap <buffer> k449 <C-o>:echo 449<CR>
+inoremap <buffer> k450 <C-o>:echo 450<CR>
+inoremap <buffer> k451 <C-o>:echo 451<CR>
+inoremap <buffer> k452 <C-o>:echo 452<CR>
+inoremap <buffer> k453 <C-o>:echo 453<CR>
+inoremap <buffer> k454 <C-o>:echo 454<CR>
+inoremap <buffer> k455 <C-o>:echo 455<CR>
+inoremap <buffer> k456 <C-o>:echo 456<CR>
+inoremap <buffer> k457 <C-o>:echo 457<CR>
+inoremap <buffer> k458 <C-o>:echo 458<CR>
+inoremap <buffer> k459 <C-o>:echo 459<CR>
+inoremap <buffer> k460 <C-o>:echo 460<CR>
+inoremap <buffer> k461 <C-o>:echo 461<CR>
+inoremap <buffer> k462 <C-o>:echo 462<CR>
+inoremap <buffer> k463 <C-o>:echo 463<CR>
+inoremap <buffer> k464 <C-o>:echo 464<CR>
+inoremap <buffer> k465 <C-o>:echo 465<CR>
+inoremap <buffer> k466 <C-o>:echo 466<CR>
+inoremap <buffer> k467 <C-o>:echo 467<CR>
+inoremap <buffer> k468 <C-o>:echo 468<CR>
+inoremap <buffer> k469 <C-o>:echo 469<CR>
+inoremap <buffer> k470 <C-o>:echo 470<CR>
+inoremap <buffer> k471 <C-o>:echo 471<CR>
+inoremap <buffer> k472 <C-o>:echo 472<CR>
+inoremap <buffer> k473 <C-o>:echo 473<CR>
+inoremap <buffer> k474 <C-o>:echo 474<CR>
+inoremap <buffer> k475 <C-o>:echo 475<CR>
+inoremap <buffer> k476 <C-o>:echo 476<CR>
+inoremap <buffer> k477 <C-o>:echo 477<CR>
+inoremap <buffer> k478 <C-o>:echo 478<CR>
+inoremap <buffer> k479 <C-o>:echo 479<CR>
+inoremap <buffer> k480 <C-o>:echo 480<CR>
+inoremap <buffer> k481 <C-o>:echo 481<CR>
+inoremap <buffer> k482 <C-o>:echo 482<CR>
+inoremap <buffer> k483 <C-o>:echo 483<CR>
+inoremap <buffer> k484 <C-o>:echo 484<CR>
+inoremap <buffer> k485 <C-o>:echo 485<CR>
+inoremap <buffer> k486 <C-o>:echo 486<CR>
+inoremap <buffer> k487 <C-o>:echo 487<CR>
+inoremap <buffer> k488 <C-o>:echo 488<CR>
+inoremap <buffer> k489 <C-o>:echo 489<CR>
+inoremap <buffer> k490 <C-o>:echo 490<CR>
+inoremap <buffer> k491 <C-o>:echo 491<CR>
+inoremap <buffer> k492 <C-o>:echo 492<CR>
+inoremap <buffer> k493 <C-o>:echo 493<CR>
+inoremap <buffer> k494 <C-o>:echo 494<CR>
+inoremap <buffer> k495 <C-o>:echo 495<CR>
+inoremap <buffer> k496 <C-o>:echo 496<CR>
+inoremap <buffer> k497 <C-o>:echo 497<CR>
+inoremap <buffer> k498 <C-o>:echo 498<CR>
+inoremap <buffer> k499 <C-o>:echo 499<CR>
@@ -0,0 +1,7 @@
+vim9script
+# 一行里层层嵌套的括号（lambda 的 ( 要向前看到配对的 )）和一长串 lambda
+var p100 = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+var p200 = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+var p300 = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+var fs = [(a, b) => a + b + 0, (a, b) => a + b + 1, (a, b) => a + b + 2, (a, b) => a + b + 3, (a, b) => a + b + 4, (a, b) => a + b + 5, (a, b) => a + b + 6, (a, b) => a + b + 7, (a, b) => a + b + 8, (a, b) => a + b + 9, (a, b) => a + b + 10, (a, b) => a + b + 11, (a, b) => a + b + 12, (a, b) => a + b + 13, (a, b) => a + b + 14, (a, b) => a + b + 15, (a, b) => a + b + 16, (a, b) => a + b + 17, (a, b) => a + b + 18, (a, b) => a + b + 19, (a, b) => a + b + 20, (a, b) => a + b + 21, (a, b) => a + b + 22, (a, b) => a + b + 23, (a, b) => a + b + 24, (a, b) => a + b + 25, (a, b) => a + b + 26, (a, b) => a + b + 27, (a, b) => a + b + 28, (a, b) => a + b + 29, (a, b) => a + b + 30, (a, b) => a + b + 31, (a, b) => a + b + 32, (a, b) => a + b + 33, (a, b) => a + b + 34, (a, b) => a + b + 35, (a, b) => a + b + 36, (a, b) => a + b + 37, (a, b) => a + b + 38, (a, b) => a + b + 39, (a, b) => a + b + 40, (a, b) => a + b + 41, (a, b) => a + b + 42, (a, b) => a + b + 43, (a, b) => a + b + 44, (a, b) => a + b + 45, (a, b) => a + b + 46, (a, b) => a + b + 47, (a, b) => a + b + 48, (a, b) => a + b + 49, (a, b) => a + b + 50, (a, b) => a + b + 51, (a, b) => a + b + 52, (a, b) => a + b + 53, (a, b) => a + b + 54, (a, b) => a + b + 55, (a, b) => a + b + 56, (a, b) => a + b + 57, (a, b) => a + b + 58, (a, b) => a + b + 59, (a, b) => a + b + 60, (a, b) => a + b + 61, (a, b) => a + b + 62, (a, b) => a + b + 63, (a, b) => a + b + 64, (a, b) => a + b + 65, (a, b) => a + b + 66, (a, b) => a + b + 67, (a, b) => a + b + 68, (a, b) => a + b + 69, (a, b) => a + b + 70, (a, b) => a + b + 71, (a, b) => a + b + 72, (a, b) => a + b + 73, (a, b) => a + b + 74, (a, b) => a + b + 75, (a, b) => a + b + 76, (a, b) => a + b + 77, (a, b) => a + b + 78, (a, b) => a + b + 79, (a, b) => a + b + 80, (a, b) => a + b + 81, (a, b) => a + b + 82, (a, b) => a + b + 83, (a, b) => a + b + 84, (a, b) => a + b + 85, (a, b) => a + b + 86, (a, b) => a + b + 87, (a, b) => a + b + 88, (a, b) => a + b + 89, (a, b) => a + b + 90, (a, b) => a + b + 91, (a, b) => a + b + 92, (a, b) => a + b + 93, (a, b) => a + b + 94, (a, b) => a + b + 95, (a, b) => a + b + 96, (a, b) => a + b + 97, (a, b) => a + b + 98, (a, b) => a + b + 99, (a, b) => a + b + 100, (a, b) => a + b + 101, (a, b) => a + b + 102, (a, b) => a + b + 103, (a, b) => a + b + 104, (a, b) => a + b + 105, (a, b) => a + b + 106, (a, b) => a + b + 107, (a, b) => a + b + 108, (a, b) => a + b + 109, (a, b) => a + b + 110, (a, b) => a + b + 111, (a, b) => a + b + 112, (a, b) => a + b + 113, (a, b) => a + b + 114, (a, b) => a + b + 115, (a, b) => a + b + 116, (a, b) => a + b + 117, (a, b) => a + b + 118, (a, b) => a + b + 119, (a, b) => a + b + 120, (a, b) => a + b + 121, (a, b) => a + b + 122, (a, b) => a + b + 123, (a, b) => a + b + 124, (a, b) => a + b + 125, (a, b) => a + b + 126, (a, b) => a + b + 127, (a, b) => a + b + 128, (a, b) => a + b + 129, (a, b) => a + b + 130, (a, b) => a + b + 131, (a, b) => a + b + 132, (a, b) => a + b + 133, (a, b) => a + b + 134, (a, b) => a + b + 135, (a, b) => a + b + 136, (a, b) => a + b + 137, (a, b) => a + b + 138, (a, b) => a + b + 139, (a, b) => a + b + 140, (a, b) => a + b + 141, (a, b) => a + b + 142, (a, b) => a + b + 143, (a, b) => a + b + 144, (a, b) => a + b + 145, (a, b) => a + b + 146, (a, b) => a + b + 147, (a, b) => a + b + 148, (a, b) => a + b + 149, (a, b) => a + b + 150, (a, b) => a + b + 151, (a, b) => a + b + 152, (a, b) => a + b + 153, (a, b) => a + b + 154, (a, b) => a + b + 155, (a, b) => a + b + 156, (a, b) => a + b + 157, (a, b) => a + b + 158, (a, b) => a + b + 159, (a, b) => a + b + 160, (a, b) => a + b + 161, (a, b) => a + b + 162, (a, b) => a + b + 163, (a, b) => a + b + 164, (a, b) => a + b + 165, (a, b) => a + b + 166, (a, b) => a + b + 167, (a, b) => a + b + 168, (a, b) => a + b + 169, (a, b) => a + b + 170, (a, b) => a + b + 171, (a, b) => a + b + 172, (a, b) => a + b + 173, (a, b) => a + b + 174, (a, b) => a + b + 175, (a, b) => a + b + 176, (a, b) => a + b + 177, (a, b) => a + b + 178, (a, b) => a + b + 179, (a, b) => a + b + 180, (a, b) => a + b + 181, (a, b) => a + b + 182, (a, b) => a + b + 183, (a, b) => a + b + 184, (a, b) => a + b + 185, (a, b) => a + b + 186, (a, b) => a + b + 187, (a, b) => a + b + 188, (a, b) => a + b + 189, (a, b) => a + b + 190, (a, b) => a + b + 191, (a, b) => a + b + 192, (a, b) => a + b + 193, (a, b) => a + b + 194, (a, b) => a + b + 195, (a, b) => a + b + 196, (a, b) => a + b + 197, (a, b) => a + b + 198, (a, b) => a + b + 199, (a, b) => a + b + 200, (a, b) => a + b + 201, (a, b) => a + b + 202, (a, b) => a + b + 203, (a, b) => a + b + 204, (a, b) => a + b + 205, (a, b) => a + b + 206, (a, b) => a + b + 207, (a, b) => a + b + 208, (a, b) => a + b + 209, (a, b) => a + b + 210, (a, b) => a + b + 211, (a, b) => a + b + 212, (a, b) => a + b + 213, (a, b) => a + b + 214, (a, b) => a + b + 215, (a, b) => a + b + 216, (a, b) => a + b + 217, (a, b) => a + b + 218, (a, b) => a + b + 219, (a, b) => a + b + 220, (a, b) => a + b + 221, (a, b) => a + b + 222, (a, b) => a + b + 223, (a, b) => a + b + 224, (a, b) => a + b + 225, (a, b) => a + b + 226, (a, b) => a + b + 227, (a, b) => a + b + 228, (a, b) => a + b + 229, (a, b) => a + b + 230, (a, b) => a + b + 231, (a, b) => a + b + 232, (a, b) => a + b + 233, (a, b) => a + b + 234, (a, b) => a + b + 235, (a, b) => a + b + 236, (a, b) => a + b + 237, (a, b) => a + b + 238, (a, b) => a + b + 239, (a, b) => a + b + 240, (a, b) => a + b + 241, (a, b) => a + b + 242, (a, b) => a + b + 243, (a, b) => a + b + 244, (a, b) => a + b + 245, (a, b) => a + b + 246, (a, b) => a + b + 247, (a, b) => a + b + 248, (a, b) => a + b + 249, (a, b) => a + b + 250, (a, b) => a + b + 251, (a, b) => a + b + 252, (a, b) => a + b + 253, (a, b) => a + b + 254, (a, b) => a + b + 255, (a, b) => a + b + 256, (a, b) => a + b + 257, (a, b) => a + b + 258, (a, b) => a + b + 259, (a, b) => a + b + 260, (a, b) => a + b + 261, (a, b) => a + b + 262, (a, b) => a + b + 263, (a, b) => a + b + 264, (a, b) => a + b + 265, (a, b) => a + b + 266, (a, b) => a + b + 267, (a, b) => a + b + 268, (a, b) => a + b + 269, (a, b) => a + b + 270, (a, b) => a + b + 271, (a, b) => a + b + 272, (a, b) => a + b + 273, (a, b) => a + b + 274, (a, b) => a + b + 275, (a, b) => a + b + 276, (a, b) => a + b + 277, (a, b) => a + b + 278, (a, b) => a + b + 279, (a, b) => a + b + 280, (a, b) => a + b + 281, (a, b) => a + b + 282, (a, b) => a + b + 283, (a, b) => a + b + 284, (a, b) => a + b + 285, (a, b) => a + b + 286, (a, b) => a + b + 287, (a, b) => a + b + 288, (a, b) => a + b + 289, (a, b) => a + b + 290, (a, b) => a + b + 291, (a, b) => a + b + 292, (a, b) => a + b + 293, (a, b) => a + b + 294, (a, b) => a + b + 295, (a, b) => a + b + 296, (a, b) => a + b + 297, (a, b) => a + b + 298, (a, b) => a + b + 299, (a, b) => a + b + 300, (a, b) => a + b + 301, (a, b) => a + b + 302, (a, b) => a + b + 303, (a, b) => a + b + 304, (a, b) => a + b + 305, (a, b) => a + b + 306, (a, b) => a + b + 307, (a, b) => a + b + 308, (a, b) => a + b + 309, (a, b) => a + b + 310, (a, b) => a + b + 311, (a, b) => a + b + 312, (a, b) => a + b + 313, (a, b) => a + b + 314, (a, b) => a + b + 315, (a, b) => a + b + 316, (a, b) => a + b + 317, (a, b) => a + b + 318, (a, b) => a + b + 319, (a, b) => a + b + 320, (a, b) => a + b + 321, (a, b) => a + b + 322, (a, b) => a + b + 323, (a, b) => a + b + 324, (a, b) => a + b + 325, (a, b) => a + b + 326, (a, b) => a + b + 327, (a, b) => a + b + 328, (a, b) => a + b + 329, (a, b) => a + b + 330, (a, b) => a + b + 331, (a, b) => a + b + 332, (a, b) => a + b + 333, (a, b) => a + b + 334, (a, b) => a + b + 335, (a, b) => a + b + 336, (a, b) => a + b + 337, (a, b) => a + b + 338, (a, b) => a + b + 339, (a, b) => a + b + 340, (a, b) => a + b + 341, (a, b) => a + b + 342, (a, b) => a + b + 343, (a, b) => a + b + 344, (a, b) => a + b + 345, (a, b) => a + b + 346, (a, b) => a + b + 347, (a, b) => a + b + 348, (a, b) => a + b + 349, (a, b) => a + b + 350, (a, b) => a + b + 351, (a, b) => a + b + 352, (a, b) => a + b + 353, (a, b) => a + b + 354, (a, b) => a + b + 355, (a, b) => a + b + 356, (a, b) => a + b + 357, (a, b) => a + b + 358, (a, b) => a + b + 359, (a, b) => a + b + 360, (a, b) => a + b + 361, (a, b) => a + b + 362, (a, b) => a + b + 363, (a, b) => a + b + 364, (a, b) => a + b + 365, (a, b) => a + b + 366, (a, b) => a + b + 367, (a, b) => a + b + 368, (a, b) => a + b + 369, (a, b) => a + b + 370, (a, b) => a + b + 371, (a, b) => a + b + 372, (a, b) => a + b + 373, (a, b) => a + b + 374, (a, b) => a + b + 375, (a, b) => a + b + 376, (a, b) => a + b + 377, (a, b) => a + b + 378, (a, b) => a + b + 379, (a, b) => a + b + 380, (a, b) => a + b + 381, (a, b) => a + b + 382, (a, b) => a + b + 383, (a, b) => a + b + 384, (a, b) => a + b + 385, (a, b) => a + b + 386, (a, b) => a + b + 387, (a, b) => a + b + 388, (a, b) => a + b + 389, (a, b) => a + b + 390, (a, b) => a + b + 391, (a, b) => a + b + 392, (a, b) => a + b + 393, (a, b) => a + b + 394, (a, b) => a + b + 395, (a, b) => a + b + 396, (a, b) => a + b + 397, (a, b) => a + b + 398, (a, b) => a + b + 399]
+var gs = [(s) => s .. '(0', (s) => s .. '(1', (s) => s .. '(2', (s) => s .. '(3', (s) => s .. '(4', (s) => s .. '(5', (s) => s .. '(6', (s) => s .. '(7', (s) => s .. '(8', (s) => s .. '(9', (s) => s .. '(10', (s) => s .. '(11', (s) => s .. '(12', (s) => s .. '(13', (s) => s .. '(14', (s) => s .. '(15', (s) => s .. '(16', (s) => s .. '(17', (s) => s .. '(18', (s) => s .. '(19', (s) => s .. '(20', (s) => s .. '(21', (s) => s .. '(22', (s) => s .. '(23', (s) => s .. '(24', (s) => s .. '(25', (s) => s .. '(26', (s) => s .. '(27', (s) => s .. '(28', (s) => s .. '(29', (s) => s .. '(30', (s) => s .. '(31', (s) => s .. '(32', (s) => s .. '(33', (s) => s .. '(34', (s) => s .. '(35', (s) => s .. '(36', (s) => s .. '(37', (s) => s .. '(38', (s) => s .. '(39', (s) => s .. '(40', (s) => s .. '(41', (s) => s .. '(42', (s) => s .. '(43', (s) => s .. '(44', (s) => s .. '(45', (s) => s .. '(46', (s) => s .. '(47', (s) => s .. '(48', (s) => s .. '(49', (s) => s .. '(50', (s) => s .. '(51', (s) => s .. '(52', (s) => s .. '(53', (s) => s .. '(54', (s) => s .. '(55', (s) => s .. '(56', (s) => s .. '(57', (s) => s .. '(58', (s) => s .. '(59', (s) => s .. '(60', (s) => s .. '(61', (s) => s .. '(62', (s) => s .. '(63', (s) => s .. '(64', (s) => s .. '(65', (s) => s .. '(66', (s) => s .. '(67', (s) => s .. '(68', (s) => s .. '(69', (s) => s .. '(70', (s) => s .. '(71', (s) => s .. '(72', (s) => s .. '(73', (s) => s .. '(74', (s) => s .. '(75', (s) => s .. '(76', (s) => s .. '(77', (s) => s .. '(78', (s) => s .. '(79', (s) => s .. '(80', (s) => s .. '(81', (s) => s .. '(82', (s) => s .. '(83', (s) => s .. '(84', (s) => s .. '(85', (s) => s .. '(86', (s) => s .. '(87', (s) => s .. '(88', (s) => s .. '(89', (s) => s .. '(90', (s) => s .. '(91', (s) => s .. '(92', (s) => s .. '(93', (s) => s .. '(94', (s) => s .. '(95', (s) => s .. '(96', (s) => s .. '(97', (s) => s .. '(98', (s) => s .. '(99', (s) => s .. '(100', (s) => s .. '(101', (s) => s .. '(102', (s) => s .. '(103', (s) => s .. '(104', (s) => s .. '(105', (s) => s .. '(106', (s) => s .. '(107', (s) => s .. '(108', (s) => s .. '(109', (s) => s .. '(110', (s) => s .. '(111', (s) => s .. '(112', (s) => s .. '(113', (s) => s .. '(114', (s) => s .. '(115', (s) => s .. '(116', (s) => s .. '(117', (s) => s .. '(118', (s) => s .. '(119', (s) => s .. '(120', (s) => s .. '(121', (s) => s .. '(122', (s) => s .. '(123', (s) => s .. '(124', (s) => s .. '(125', (s) => s .. '(126', (s) => s .. '(127', (s) => s .. '(128', (s) => s .. '(129', (s) => s .. '(130', (s) => s .. '(131', (s) => s .. '(132', (s) => s .. '(133', (s) => s .. '(134', (s) => s .. '(135', (s) => s .. '(136', (s) => s .. '(137', (s) => s .. '(138', (s) => s .. '(139', (s) => s .. '(140', (s) => s .. '(141', (s) => s .. '(142', (s) => s .. '(143', (s) => s .. '(144', (s) => s .. '(145', (s) => s .. '(146', (s) => s .. '(147', (s) => s .. '(148', (s) => s .. '(149', (s) => s .. '(150', (s) => s .. '(151', (s) => s .. '(152', (s) => s .. '(153', (s) => s .. '(154', (s) => s .. '(155', (s) => s .. '(156', (s) => s .. '(157', (s) => s .. '(158', (s) => s .. '(159', (s) => s .. '(160', (s) => s .. '(161', (s) => s .. '(162', (s) => s .. '(163', (s) => s .. '(164', (s) => s .. '(165', (s) => s .. '(166', (s) => s .. '(167', (s) => s .. '(168', (s) => s .. '(169', (s) => s .. '(170', (s) => s .. '(171', (s) => s .. '(172', (s) => s .. '(173', (s) => s .. '(174', (s) => s .. '(175', (s) => s .. '(176', (s) => s .. '(177', (s) => s .. '(178', (s) => s .. '(179', (s) => s .. '(180', (s) => s .. '(181', (s) => s .. '(182', (s) => s .. '(183', (s) => s .. '(184', (s) => s .. '(185', (s) => s .. '(186', (s) => s .. '(187', (s) => s .. '(188', (s) => s .. '(189', (s) => s .. '(190', (s) => s .. '(191', (s) => s .. '(192', (s) => s .. '(193', (s) => s .. '(194', (s) => s .. '(195', (s) => s .. '(196', (s) => s .. '(197', (s) => s .. '(198', (s) => s .. '(199', (s) => s .. '(200', (s) => s .. '(201', (s) => s .. '(202', (s) => s .. '(203', (s) => s .. '(204', (s) => s .. '(205', (s) => s .. '(206', (s) => s .. '(207', (s) => s .. '(208', (s) => s .. '(209', (s) => s .. '(210', (s) => s .. '(211', (s) => s .. '(212', (s) => s .. '(213', (s) => s .. '(214', (s) => s .. '(215', (s) => s .. '(216', (s) => s .. '(217', (s) => s .. '(218', (s) => s .. '(219', (s) => s .. '(220', (s) => s .. '(221', (s) => s .. '(222', (s) => s .. '(223', (s) => s .. '(224', (s) => s .. '(225', (s) => s .. '(226', (s) => s .. '(227', (s) => s .. '(228', (s) => s .. '(229', (s) => s .. '(230', (s) => s .. '(231', (s) => s .. '(232', (s) => s .. '(233', (s) => s .. '(234', (s) => s .. '(235', (s) => s .. '(236', (s) => s .. '(237', (s) => s .. '(238', (s) => s .. '(239', (s) => s .. '(240', (s) => s .. '(241', (s) => s .. '(242', (s) => s .. '(243', (s) => s .. '(244', (s) => s .. '(245', (s) => s .. '(246', (s) => s .. '(247', (s) => s .. '(248', (s) => s .. '(249', (s) => s .. '(250', (s) => s .. '(251', (s) => s .. '(252', (s) => s .. '(253', (s) => s .. '(254', (s) => s .. '(255', (s) => s .. '(256', (s) => s .. '(257', (s) => s .. '(258', (s) => s .. '(259', (s) => s .. '(260', (s) => s .. '(261', (s) => s .. '(262', (s) => s .. '(263', (s) => s .. '(264', (s) => s .. '(265', (s) => s .. '(266', (s) => s .. '(267', (s) => s .. '(268', (s) => s .. '(269', (s) => s .. '(270', (s) => s .. '(271', (s) => s .. '(272', (s) => s .. '(273', (s) => s .. '(274', (s) => s .. '(275', (s) => s .. '(276', (s) => s .. '(277', (s) => s .. '(278', (s) => s .. '(279', (s) => s .. '(280', (s) => s .. '(281', (s) => s .. '(282', (s) => s .. '(283', (s) => s .. '(284', (s) => s .. '(285', (s) => s .. '(286', (s) => s .. '(287', (s) => s .. '(288', (s) => s .. '(289', (s) => s .. '(290', (s) => s .. '(291', (s) => s .. '(292', (s) => s .. '(293', (s) => s .. '(294', (s) => s .. '(295', (s) => s .. '(296', (s) => s .. '(297', (s) => s .. '(298', (s) => s .. '(299', (s) => s .. '(300', (s) => s .. '(301', (s) => s .. '(302', (s) => s .. '(303', (s) => s .. '(304', (s) => s .. '(305', (s) => s .. '(306', (s) => s .. '(307', (s) => s .. '(308', (s) => s .. '(309', (s) => s .. '(310', (s) => s .. '(311', (s) => s .. '(312', (s) => s .. '(313', (s) => s .. '(314', (s) => s .. '(315', (s) => s .. '(316', (s) => s .. '(317', (s) => s .. '(318', (s) => s .. '(319', (s) => s .. '(320', (s) => s .. '(321', (s) => s .. '(322', (s) => s .. '(323', (s) => s .. '(324', (s) => s .. '(325', (s) => s .. '(326', (s) => s .. '(327', (s) => s .. '(328', (s) => s .. '(329', (s) => s .. '(330', (s) => s .. '(331', (s) => s .. '(332', (s) => s .. '(333', (s) => s .. '(334', (s) => s .. '(335', (s) => s .. '(336', (s) => s .. '(337', (s) => s .. '(338', (s) => s .. '(339', (s) => s .. '(340', (s) => s .. '(341', (s) => s .. '(342', (s) => s .. '(343', (s) => s .. '(344', (s) => s .. '(345', (s) => s .. '(346', (s) => s .. '(347', (s) => s .. '(348', (s) => s .. '(349', (s) => s .. '(350', (s) => s .. '(351', (s) => s .. '(352', (s) => s .. '(353', (s) => s .. '(354', (s) => s .. '(355', (s) => s .. '(356', (s) => s .. '(357', (s) => s .. '(358', (s) => s .. '(359', (s) => s .. '(360', (s) => s .. '(361', (s) => s .. '(362', (s) => s .. '(363', (s) => s .. '(364', (s) => s .. '(365', (s) => s .. '(366', (s) => s .. '(367', (s) => s .. '(368', (s) => s .. '(369', (s) => s .. '(370', (s) => s .. '(371', (s) => s .. '(372', (s) => s .. '(373', (s) => s .. '(374', (s) => s .. '(375', (s) => s .. '(376', (s) => s .. '(377', (s) => s .. '(378', (s) => s .. '(379', (s) => s .. '(380', (s) => s .. '(381', (s) => s .. '(382', (s) => s .. '(383', (s) => s .. '(384', (s) => s .. '(385', (s) => s .. '(386', (s) => s .. '(387', (s) => s .. '(388', (s) => s .. '(389', (s) => s .. '(390', (s) => s .. '(391', (s) => s .. '(392', (s) => s .. '(393', (s) => s .. '(394', (s) => s .. '(395', (s) => s .. '(396', (s) => s .. '(397', (s) => s .. '(398', (s) => s .. '(399']
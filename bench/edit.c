@@ -0,0 +1,282 @@
+// edit.c
+// 增量模式：在一个合成的 2000 行 def 里按脚本做 ts_tree_edit + 重新解析，
+// 统计每次重解析的耗时和 ts_tree_get_changed_ranges 的大小。
+// 重解析的工作量应当跟编辑大小相关，而不是跟文件大小相关。
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EDIT_BODY_LINES 2000
+
+typedef struct {
+    char *data;
+    uint32_t length;
+    uint32_t capacity;
+} Buffer;
+
+// 一次编辑：在 offset 处删掉 remove 个字节，再插入 text
+typedef struct {
+    uint32_t offset;
+    uint32_t remove;
+    const char *text;
+} EditOp;
+
+typedef struct {
+    const char *name;
+    EditOp *ops;
+    size_t count;
+} Script;
+
+// 合成源码里几个编辑脚本要用到的位置
+typedef struct {
+    uint32_t typing;  // 函数体中间某行的行尾
+    uint32_t chain;   // 另一条普通语句的行尾
+    uint32_t endif;   // 中间某个 endif 的起点
+    uint32_t enddef;  // 最后 enddef 的起点
+} Anchors;
+
+static void buffer_append(Buffer *b, const char *text) {
+    uint32_t n = (uint32_t)strlen(text);
+    if (b->length + n + 1 > b->capacity) {
+        b->capacity = (b->length + n + 1) * 2;
+        b->data = realloc(b->data, b->capacity);
+    }
+    memcpy(b->data + b->length, text, n);
+    b->length += n;
+    b->data[b->length] = '\0';
+}
+
+static TSPoint buffer_point(const Buffer *b, uint32_t offset) {
+    TSPoint point = {0, 0};
+    for (uint32_t i = 0; i < offset; i++) {
+        if (b->data[i] == '\n') {
+            point.row++;
+            point.column = 0;
+        } else {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+static TSInputEdit buffer_apply(Buffer *b, const EditOp *op) {
+    uint32_t added = (uint32_t)strlen(op->text);
+    TSInputEdit edit = {
+        .start_byte = op->offset,
+        .old_end_byte = op->offset + op->remove,
+        .new_end_byte = op->offset + added,
+        .start_point = buffer_point(b, op->offset),
+        .old_end_point = buffer_point(b, op->offset + op->remove),
+    };
+
+    uint32_t length = b->length - op->remove + added;
+    if (length + 1 > b->capacity) {
+        b->capacity = (length + 1) * 2;
+        b->data = realloc(b->data, b->capacity);
+    }
+    memmove(b->data + op->offset + added, b->data + op->offset + op->remove,
+            b->length - op->offset - op->remove + 1);
+    memcpy(b->data + op->offset, op->text, added);
+    b->length = length;
+
+    edit.new_end_point = buffer_point(b, edit.new_end_byte);
+    return edit;
+}
+
+// 一个长 def：普通语句、if/endif、for/endfor 交替出现
+static void synthesize(Buffer *b, Anchors *anchors) {
+    buffer_append(b, "vim9script\n\ndef Big(n: number): number\n  var total = 0\n");
+    for (unsigned line = 0; line < EDIT_BODY_LINES;) {
+        switch ((line / 4) % 3) {
+            case 0:
+                buffer_append(b, "  total += n * 2\n");
+                if (line >= EDIT_BODY_LINES / 3 && !anchors->chain) {
+                    anchors->chain = b->length - 1;
+                }
+                buffer_append(b, "  Log('step ' .. total)\n");
+                if (line >= EDIT_BODY_LINES / 2 && !anchors->typing) {
+                    anchors->typing = b->length - 1;
+                }
+                buffer_append(b, "  total = total - 1\n  g:last = total\n");
+                break;
+            case 1:
+                buffer_append(b, "  if total > n\n    total -= n\n  ");
+                if (line >= EDIT_BODY_LINES / 2 && !anchors->endif) {
+                    anchors->endif = b->length;
+                }
+                buffer_append(b, "endif\n  echo total\n");
+                break;
+            default:
+                buffer_append(b, "  for i in range(n)\n    total += i\n  endfor\n"
+                                 "  setline(1, string(total))\n");
+                break;
+        }
+        line += 4;
+    }
+    buffer_append(b, "  return total\n");
+    anchors->enddef = b->length;
+    buffer_append(b, "enddef\n\nBig(10)\n");
+}
+
+// 逐字符输入 text，从 offset 开始
+static size_t script_type(EditOp *ops, uint32_t offset, const char *text) {
+    size_t n = strlen(text);
+    for (size_t i = 0; i < n; i++) {
+        ops[i] = (EditOp){offset + (uint32_t)i, 0, strndup(text + i, 1)};
+    }
+    return n;
+}
+
+// 删掉一个关键字再敲回去
+static size_t script_toggle(EditOp *ops, uint32_t offset, const char *word) {
+    ops[0] = (EditOp){offset, (uint32_t)strlen(word), strdup("")};
+    ops[1] = (EditOp){offset, 0, strdup(word)};
+    return 2;
+}
+
+static void script_free(Script *script) {
+    for (size_t i = 0; i < script->count; i++) {
+        free((char *)script->ops[i].text);
+    }
+    free(script->ops);
+}
+
+typedef struct {
+    uint64_t *samples;
+    size_t count;
+    uint64_t changed_bytes;
+    uint64_t changed_bytes_max;
+    uint64_t changed_ranges;
+} ScriptResult;
+
+static void run_script(TSParser *parser, const Buffer *source, const TSTree *base,
+                       const Script *script, const BenchOptions *options,
+                       ScriptResult *result) {
+    result->samples = malloc((script->count * options->iterations + 1) * sizeof(uint64_t));
+
+    for (unsigned round = 0; round < options->warmup + options->iterations; round++) {
+        bool measured = round >= options->warmup;
+        Buffer b = {malloc(source->capacity), source->length, source->capacity};
+        memcpy(b.data, source->data, source->length + 1);
+        TSTree *tree = ts_tree_copy(base);
+
+        for (size_t i = 0; i < script->count; i++) {
+            TSInputEdit edit = buffer_apply(&b, &script->ops[i]);
+            ts_tree_edit(tree, &edit);
+
+            uint64_t start = bench_now_ns();
+            TSTree *next = ts_parser_parse_string(parser, tree, b.data, b.length);
+            uint64_t elapsed = bench_now_ns() - start;
+
+            uint32_t range_count;
+            TSRange *ranges = ts_tree_get_changed_ranges(tree, next, &range_count);
+            if (measured) {
+                uint64_t bytes = 0;
+                for (uint32_t r = 0; r < range_count; r++) {
+                    bytes += ranges[r].end_byte - ranges[r].start_byte;
+                }
+                result->samples[result->count++] = elapsed;
+                result->changed_ranges += range_count;
+                result->changed_bytes += bytes;
+                if (bytes > result->changed_bytes_max) {
+                    result->changed_bytes_max = bytes;
+                }
+            }
+            free(ranges);
+            ts_tree_delete(tree);
+            tree = next;
+        }
+
+        ts_tree_delete(tree);
+        free(b.data);
+    }
+}
+
+int bench_edit(const BenchOptions *options) {
+    TSParser *parser = bench_parser_new();
+    if (!parser) {
+        return 1;
+    }
+
+    Buffer source = {0};
+    Anchors anchors = {0};
+    synthesize(&source, &anchors);
+
+    // 完整解析作为对照
+    uint64_t *full = malloc(options->iterations * sizeof(uint64_t));
+    TSTree *base = NULL;
+    for (unsigned i = 0; i < options->iterations; i++) {
+        uint64_t start = bench_now_ns();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, source.data, source.length);
+        full[i] = bench_now_ns() - start;
+        if (base) {
+            ts_tree_delete(base);
+        }
+        base = tree;
+    }
+    double full_p50 = bench_percentile(full, options->iterations, 50) / 1e6;
+    free(full);
+
+    static const char typed_line[] = "\n  Log('typed ' .. string(n))";
+    static const char chain[] = " | total += 1";
+    Script scripts[4] = {
+        {"type", calloc(sizeof(typed_line), sizeof(EditOp)), 0},
+        {"chain", calloc(sizeof(chain), sizeof(EditOp)), 0},
+        {"endif", calloc(2, sizeof(EditOp)), 0},
+        {"enddef", calloc(2, sizeof(EditOp)), 0},
+    };
+    scripts[0].count = script_type(scripts[0].ops, anchors.typing, typed_line);
+    scripts[1].count = script_type(scripts[1].ops, anchors.chain, chain);
+    scripts[2].count = script_toggle(scripts[2].ops, anchors.endif, "endif");
+    scripts[3].count = script_toggle(scripts[3].ops, anchors.enddef, "enddef");
+
+    if (options->json) {
+        printf("{\"mode\": \"edit\", \"lines\": %d, \"bytes\": %" PRIu32
+               ", \"iterations\": %u, \"full_parse_ms\": %.4f, \"scripts\": [",
+               EDIT_BODY_LINES, source.length, options->iterations, full_p50);
+    } else {
+        printf("source:      %d-line def (%" PRIu32 " bytes), full parse p50 %.3f ms\n",
+               EDIT_BODY_LINES, source.length, full_p50);
+    }
+
+    for (size_t s = 0; s < 4; s++) {
+        ScriptResult result = {0};
+        run_script(parser, &source, base, &scripts[s], options, &result);
+
+        double changed_mean = result.count ? (double)result.changed_bytes / result.count : 0;
+        double ranges_mean = result.count ? (double)result.changed_ranges / result.count : 0;
+        double p50 = bench_percentile(result.samples, result.count, 50) / 1e6;
+        double p99 = bench_percentile(result.samples, result.count, 99) / 1e6;
+
+        if (options->json) {
+            printf("%s{\"name\": \"%s\", \"edits\": %zu, \"p50_ms\": %.4f, \"p99_ms\": %.4f"
+                   ", \"changed_ranges_mean\": %.2f, \"changed_bytes_mean\": %.1f"
+                   ", \"changed_bytes_max\": %" PRIu64 "}",
+                   s ? ", " : "", scripts[s].name, scripts[s].count, p50, p99, ranges_mean,
+                   changed_mean, result.changed_bytes_max);
+        } else {
+            printf("%-12s %3zu edits, reparse p50 %.3f ms, p99 %.3f ms, "
+                   "changed %.1f range(s) / %.0f bytes mean, %" PRIu64 " bytes max\n",
+                   scripts[s].name, scripts[s].count, p50, p99, ranges_mean, changed_mean,
+                   result.changed_bytes_max);
+        }
+
+        free(result.samples);
+        script_free(&scripts[s]);
+    }
+
+    if (options->json) {
+        printf("]}\n");
+    }
+
+    ts_tree_delete(base);
+    free(source.data);
+    ts_parser_delete(parser);
+    return 0;
+}
@@ -0,0 +1,123 @@
+// main.c
+// vim9-bench：tree-sitter-vim9 的解析性能基准。
+//
+//   vim9-bench [-n iterations] [-w warmup] [--json] [--arena] [--profile out.json] <file-or-dir>...
+//   vim9-bench [-n iterations] [-w warmup] [--json] --edit
+//   vim9-bench [-n iterations] [-w warmup] [--json] [--match-limit N] --query q.scm... <file-or-dir>...
+//   vim9-bench [-n iterations] [-w warmup] [--json] [--stream-mb N] [--chunk KB] [-j N] --stream [<file-or-dir>...]
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n iterations] [-w warmup] [--json] [--arena] [--profile FILE]"
+            " <file-or-dir>...\n"
+            "       %s [-n iterations] [-w warmup] [--json] --edit\n"
+            "       %s [-n iterations] [-w warmup] [--json] [--match-limit N] --query FILE..."
+            " <file-or-dir>...\n"
+            "       %s [-n iterations] [-w warmup] [--json] [--stream-mb N] [--chunk KB] [-j N]"
+            " --stream [<file-or-dir>...]\n"
+            "  -n N     measured rounds over the corpus (default 10)\n"
+            "  -w N     unmeasured warm-up rounds (default 1)\n"
+            "  --json   print one JSON object instead of a table\n"
+            "  --edit   time incremental reparses of a synthesized 2000-line def\n"
+            "  --arena  parse each file with a fresh parser inside a reset-per-file arena\n"
+            "  --profile FILE\n"
+            "           write shift/reduce counts per parse state (and, in a\n"
+            "           TREE_SITTER_PROFILE build, the lexer counters) to FILE as JSON\n"
+            "  --query FILE\n"
+            "           time running the query in FILE over the parsed corpus instead\n"
+            "           of parsing; may be given more than once\n"
+            "  --match-limit N\n"
+            "           TSQueryCursor match limit for --query (default 256)\n"
+            "  --stream parse one large file (the corpus concatenated, or a synthesized\n"
+            "           generated file) in chunks with tree_sitter_vim9_parse_stream()\n"
+            "  --stream-mb N\n"
+            "           size of that file (default 64)\n"
+            "  --chunk KB\n"
+            "           chunk size for --stream (default 1024)\n"
+            "  -j N     parse threads for --stream (default 1)\n",
+            prog, prog, prog, prog);
+}
+
+int main(int argc, char **argv) {
+    BenchOptions options = {.iterations = 10, .warmup = 1, .json = false, .edit = false,
+                            .arena = false, .profile = NULL, .match_limit = 256,
+                            .stream_mb = 64, .chunk_kb = 1024, .threads = 1};
+    BenchCorpus corpus = {0};
+    const char **queries = malloc((size_t)argc * sizeof(const char *));
+    options.queries = queries;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if ((strcmp(arg, "-n") == 0 || strcmp(arg, "-w") == 0) && i + 1 < argc) {
+            unsigned value = (unsigned)strtoul(argv[++i], NULL, 10);
+            if (arg[1] == 'n') {
+                options.iterations = value ? value : 1;
+            } else {
+                options.warmup = value;
+            }
+        } else if (strcmp(arg, "--json") == 0) {
+            options.json = true;
+        } else if (strcmp(arg, "--edit") == 0) {
+            options.edit = true;
+        } else if (strcmp(arg, "--arena") == 0) {
+            options.arena = true;
+        } else if (strcmp(arg, "--profile") == 0 && i + 1 < argc) {
+            options.profile = argv[++i];
+        } else if (strcmp(arg, "--query") == 0 && i + 1 < argc) {
+            queries[options.query_count++] = argv[++i];
+        } else if (strcmp(arg, "--match-limit") == 0 && i + 1 < argc) {
+            options.match_limit = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--stream") == 0) {
+            options.stream = true;
+        } else if (strcmp(arg, "--stream-mb") == 0 && i + 1 < argc) {
+            options.stream_mb = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--chunk") == 0 && i + 1 < argc) {
+            options.chunk_kb = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "-j") == 0 && i + 1 < argc) {
+            options.threads = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(argv[0]);
+            free(queries);
+            return 0;
+        } else if (arg[0] == '-') {
+            usage(argv[0]);
+            free(queries);
+            return 2;
+        } else if (!bench_corpus_add(&corpus, arg)) {
+            bench_corpus_free(&corpus);
+            free(queries);
+            return 1;
+        }
+    }
+
+    if (options.edit) {
+        bench_corpus_free(&corpus);
+        free(queries);
+        return bench_edit(&options);
+    }
+
+    if (options.stream) {
+        int status = bench_stream(&corpus, &options);
+        bench_corpus_free(&corpus);
+        free(queries);
+        return status;
+    }
+
+    if (corpus.count == 0) {
+        usage(argv[0]);
+        free(queries);
+        return 2;
+    }
+
+    int status = options.query_count ? bench_query(&corpus, &options)
+                                     : bench_parse(&corpus, &options);
+    bench_corpus_free(&corpus);
+    free(queries);
+    return status;
+}
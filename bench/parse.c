@@ -0,0 +1,176 @@
+// parse.c
+// 吞吐模式：整份语料反复全量解析，统计 MB/s、nodes/s 与单文件延迟分位数。
+// 计时之前先带 logger 解析一遍，统计 GLR 分叉（栈版本数 > 1 的步数）。
+// --profile 时同一遍顺带统计 parse state 的 shift/reduce（见 profile.c）。
+// --arena 时每个文件在 arena 里新建 parser 解析，完了整体 reset，计时包含 parser 创建。
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint64_t forked_steps;
+    unsigned max_versions;
+    BenchProfile *profile;
+} ForkStats;
+
+// 解析日志里每一步都有 "process version:%u, version_count:%u, ..."
+static void count_forks(void *payload, TSLogType type, const char *message) {
+    if (type != TSLogTypeParse) {
+        return;
+    }
+    ForkStats *stats = payload;
+    if (stats->profile) {
+        bench_profile_log(stats->profile, message);
+    }
+    const char *count = strstr(message, "version_count:");
+    if (!count) {
+        return;
+    }
+    unsigned versions = (unsigned)strtoul(count + strlen("version_count:"), NULL, 10);
+    if (versions > 1) {
+        stats->forked_steps++;
+    }
+    if (versions > stats->max_versions) {
+        stats->max_versions = versions;
+    }
+}
+
+int bench_parse(const BenchCorpus *corpus, const BenchOptions *options) {
+    TSParser *parser = bench_parser_new();
+    if (!parser) {
+        return 1;
+    }
+
+    size_t sample_count = corpus->count * options->iterations;
+    uint64_t *samples = malloc((sample_count ? sample_count : 1) * sizeof(uint64_t));
+    uint64_t total_ns = 0;
+    uint64_t total_nodes = 0;
+    size_t error_files = 0;
+    size_t n = 0;
+
+    // 日志本身很慢，只在不计时的这一遍打开
+    BenchProfile profile;
+    if (options->profile && !bench_profile_init(&profile, tree_sitter_vim9())) {
+        fprintf(stderr, "out of memory\n");
+        free(samples);
+        ts_parser_delete(parser);
+        return 1;
+    }
+    ForkStats forks = {0, 1, options->profile ? &profile : NULL};
+    ts_parser_set_logger(parser, (TSLogger){&forks, count_forks});
+    for (size_t i = 0; i < corpus->count; i++) {
+        const BenchFile *file = &corpus->files[i];
+        uint64_t before = forks.forked_steps;
+        ts_tree_delete(ts_parser_parse_string(parser, NULL, file->data, file->length));
+        if (forks.forked_steps > before && !options->json) {
+            fprintf(stderr, "note: %s forked on %" PRIu64 " step(s)\n", file->path,
+                    forks.forked_steps - before);
+        }
+    }
+    ts_parser_set_logger(parser, (TSLogger){NULL, NULL});
+    if (options->profile) {
+        bool written = bench_profile_write(&profile, options->profile);
+        bench_profile_free(&profile);
+        if (!written) {
+            free(samples);
+            ts_parser_delete(parser);
+            return 1;
+        }
+    }
+
+    TreeSitterVim9Arena *arena = NULL;
+    if (options->arena) {
+        ts_set_allocator(tree_sitter_vim9_arena_malloc, tree_sitter_vim9_arena_calloc,
+                         tree_sitter_vim9_arena_realloc, tree_sitter_vim9_arena_free);
+        arena = tree_sitter_vim9_arena_new(0);
+    }
+
+    for (unsigned round = 0; round < options->warmup + options->iterations; round++) {
+        bool measured = round >= options->warmup;
+        for (size_t i = 0; i < corpus->count; i++) {
+            const BenchFile *file = &corpus->files[i];
+
+            uint64_t start = bench_now_ns();
+            TSParser *job = parser;
+            if (arena) {
+                tree_sitter_vim9_arena_enter(arena);
+                job = bench_parser_new();
+                if (!job) {
+                    tree_sitter_vim9_arena_enter(NULL);
+                    tree_sitter_vim9_arena_delete(arena);
+                    free(samples);
+                    ts_parser_delete(parser);
+                    return 1;
+                }
+            }
+            TSTree *tree = ts_parser_parse_string(job, NULL, file->data, file->length);
+            uint64_t elapsed = bench_now_ns() - start;
+
+            TSNode root = ts_tree_root_node(tree);
+            if (measured) {
+                samples[n++] = elapsed;
+                total_ns += elapsed;
+                total_nodes += ts_node_descendant_count(root);
+            }
+            if (round == 0 && ts_node_has_error(root)) {
+                error_files++;
+                if (!options->json) {
+                    fprintf(stderr, "warning: %s has syntax errors\n", file->path);
+                }
+            }
+            ts_tree_delete(tree);
+            if (arena) {
+                // 在 arena 里删几乎不花时间；扫描器状态可能来自 libc，不删会泄漏
+                ts_parser_delete(job);
+                tree_sitter_vim9_arena_enter(NULL);
+                tree_sitter_vim9_arena_reset(arena);
+            }
+        }
+    }
+    double arena_peak_kb = arena ? (double)tree_sitter_vim9_arena_peak(arena) / 1024.0 : 0;
+    tree_sitter_vim9_arena_delete(arena);
+
+    double seconds = (double)total_ns / 1e9;
+    double mb = (double)corpus->total_bytes * options->iterations / (1024.0 * 1024.0);
+    double mb_per_s = seconds > 0 ? mb / seconds : 0;
+    double nodes_per_s = seconds > 0 ? (double)total_nodes / seconds : 0;
+    double nodes_per_kb = corpus->total_bytes
+        ? (double)total_nodes / options->iterations / ((double)corpus->total_bytes / 1024.0)
+        : 0;
+    double p50 = bench_percentile(samples, n, 50) / 1e6;
+    double p99 = bench_percentile(samples, n, 99) / 1e6;
+    double rss_mb = (double)bench_peak_rss_bytes() / (1024.0 * 1024.0);
+
+    if (options->json) {
+        printf("{\"mode\": \"parse\", \"files\": %zu, \"bytes\": %" PRIu64
+               ", \"iterations\": %u, \"mb_per_s\": %.3f, \"nodes_per_s\": %.0f"
+               ", \"nodes_per_kb\": %.1f"
+               ", \"p50_ms\": %.4f, \"p99_ms\": %.4f, \"peak_rss_mb\": %.2f"
+               ", \"error_files\": %zu, \"forked_steps\": %" PRIu64
+               ", \"max_stack_versions\": %u, \"arena_peak_kb\": %.1f}\n",
+               corpus->count, corpus->total_bytes, options->iterations, mb_per_s,
+               nodes_per_s, nodes_per_kb, p50, p99, rss_mb, error_files, forks.forked_steps,
+               forks.max_versions, arena_peak_kb);
+    } else {
+        printf("files:       %zu (%" PRIu64 " bytes) x %u iterations\n", corpus->count,
+               corpus->total_bytes, options->iterations);
+        printf("throughput:  %.2f MB/s, %.0f nodes/s\n", mb_per_s, nodes_per_s);
+        printf("tree size:   %.1f nodes/KB\n", nodes_per_kb);
+        printf("latency:     p50 %.3f ms, p99 %.3f ms per file\n", p50, p99);
+        printf("peak rss:    %.1f MB\n", rss_mb);
+        printf("errors:      %zu file(s)\n", error_files);
+        printf("glr forks:   %" PRIu64 " step(s), max %u stack version(s)\n",
+               forks.forked_steps, forks.max_versions);
+        if (arena) {
+            printf("arena:       peak %.1f KB per file\n", arena_peak_kb);
+        }
+    }
+
+    free(samples);
+    ts_parser_delete(parser);
+    return 0;
+}
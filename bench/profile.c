@@ -0,0 +1,133 @@
+// profile.c
+// --profile：在不计时的那一遍里从解析日志统计每个 parse state 的 shift/reduce 次数，
+// 连同 TREE_SITTER_PROFILE 构建的词法计数（bindings/c/profile.c）写成一个 JSON 文件。
+// 归属：一步里的动作都记在这一步 "process ... state:%d" 的 state 上
+// （reduce 之后同一个 lookahead 在 goto 出来的 state 里 shift，日志不再报 state）。
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool bench_profile_init(BenchProfile *profile, const TSLanguage *language) {
+    memset(profile, 0, sizeof(*profile));
+    profile->language = language;
+    profile->state_count = ts_language_state_count(language);
+    profile->symbol_count = ts_language_symbol_count(language);
+    profile->steps = calloc(profile->state_count + 1, sizeof(uint64_t));
+    profile->shifts = calloc(profile->state_count + 1, sizeof(uint64_t));
+    profile->reduces = calloc(profile->state_count + 1, sizeof(uint64_t));
+    profile->reduced = calloc(profile->symbol_count + 1, sizeof(uint64_t));
+    if (!profile->steps || !profile->shifts || !profile->reduces || !profile->reduced) {
+        bench_profile_free(profile);
+        return false;
+    }
+#ifdef TREE_SITTER_PROFILE
+    tree_sitter_vim9_profile_reset();
+#endif
+    return true;
+}
+
+void bench_profile_free(BenchProfile *profile) {
+    free(profile->steps);
+    free(profile->shifts);
+    free(profile->reduces);
+    free(profile->reduced);
+    memset(profile, 0, sizeof(*profile));
+}
+
+// 日志里 reduce 只有 symbol 名字，按名字查回 id（不计时，线性查找即可）
+static TSSymbol symbol_for_name(const BenchProfile *profile, const char *name, size_t length) {
+    for (TSSymbol i = 0; i < profile->symbol_count; i++) {
+        const char *candidate = ts_language_symbol_name(profile->language, i);
+        if (candidate && strncmp(candidate, name, length) == 0 && candidate[length] == '\0') {
+            return i;
+        }
+    }
+    return (TSSymbol)profile->symbol_count;
+}
+
+void bench_profile_log(BenchProfile *profile, const char *message) {
+    if (strncmp(message, "process version:", strlen("process version:")) == 0) {
+        const char *state = strstr(message, ", state:");
+        if (state) {
+            unsigned long id = strtoul(state + strlen(", state:"), NULL, 10);
+            profile->state = id < profile->state_count ? (uint32_t)id : profile->state_count;
+            profile->steps[profile->state]++;
+        }
+    } else if (strncmp(message, "shift", strlen("shift")) == 0) {
+        // "shift state:%u" 和 "shift_extra"
+        profile->shifts[profile->state]++;
+    } else if (strncmp(message, "reduce sym:", strlen("reduce sym:")) == 0) {
+        const char *name = message + strlen("reduce sym:");
+        const char *end = strstr(name, ", child_count:");
+        profile->reduces[profile->state]++;
+        profile->reduced[symbol_for_name(profile, name, end ? (size_t)(end - name)
+                                                             : strlen(name))]++;
+    }
+}
+
+static void write_json_string(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(out, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(out, "\\u%04x", c);
+        } else {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+bool bench_profile_write(const BenchProfile *profile, const char *path) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        return false;
+    }
+    fprintf(out, "{\"parser\": {\"states\": [");
+    bool first = true;
+    for (uint32_t state = 0; state < profile->state_count; state++) {
+        if (!profile->steps[state] && !profile->shifts[state] && !profile->reduces[state]) {
+            continue;
+        }
+        fprintf(out,
+                "%s{\"state\": %u, \"steps\": %" PRIu64 ", \"shifts\": %" PRIu64
+                ", \"reduces\": %" PRIu64 "}",
+                first ? "" : ", ", state, profile->steps[state], profile->shifts[state],
+                profile->reduces[state]);
+        first = false;
+    }
+    fprintf(out, "], \"reductions\": {");
+    first = true;
+    for (TSSymbol symbol = 0; symbol < profile->symbol_count; symbol++) {
+        if (!profile->reduced[symbol]) {
+            continue;
+        }
+        fprintf(out, "%s", first ? "" : ", ");
+        write_json_string(out, ts_language_symbol_name(profile->language, symbol));
+        fprintf(out, ": %" PRIu64, profile->reduced[symbol]);
+        first = false;
+    }
+    fprintf(out, "}}, \"lexer\": ");
+
+    // 词法计数只有 TREE_SITTER_PROFILE 构建才有
+#ifdef TREE_SITTER_PROFILE
+    char *lexer = tree_sitter_vim9_profile_json();
+    fprintf(out, "%s}\n", lexer ? lexer : "null");
+    free(lexer);
+#else
+    fprintf(out, "null}\n");
+#endif
+    bool ok = !ferror(out);
+    if (fclose(out) != 0 || !ok) {
+        perror(path);
+        return false;
+    }
+    return true;
+}
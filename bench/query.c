@@ -0,0 +1,146 @@
+// query.c
+// 查询模式：语料每个文件先解析一次（不计时），再对每个 --query 文件反复在整棵树上
+// 跑 TSQueryCursor，按高亮的用法逐个取 capture，统计 captures/s、单文件耗时分位数，
+// 以及超出 match limit 的次数（超出后运行时会丢弃进行中的匹配，高亮就会缺块）。
+
+#include "bench.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *query_error_name(TSQueryError error) {
+    switch (error) {
+    case TSQueryErrorSyntax:
+        return "syntax error";
+    case TSQueryErrorNodeType:
+        return "unknown node type";
+    case TSQueryErrorField:
+        return "unknown field";
+    case TSQueryErrorCapture:
+        return "unknown capture";
+    case TSQueryErrorStructure:
+        return "impossible pattern";
+    case TSQueryErrorLanguage:
+        return "incompatible language";
+    default:
+        return "error";
+    }
+}
+
+// 出错位置换成行号，方便对照 .scm
+static uint32_t line_of(const BenchFile *file, uint32_t offset) {
+    uint32_t line = 1;
+    for (uint32_t i = 0; i < offset && i < file->length; i++) {
+        line += file->data[i] == '\n';
+    }
+    return line;
+}
+
+static int run_query(const BenchFile *source, TSTree **trees, const BenchCorpus *corpus,
+                     const BenchOptions *options, uint64_t *samples) {
+    uint32_t error_offset;
+    TSQueryError error;
+    TSQuery *query =
+        ts_query_new(tree_sitter_vim9(), source->data, source->length, &error_offset, &error);
+    if (!query) {
+        fprintf(stderr, "%s:%u: %s\n", source->path, line_of(source, error_offset),
+                query_error_name(error));
+        return 1;
+    }
+    TSQueryCursor *cursor = ts_query_cursor_new();
+    ts_query_cursor_set_match_limit(cursor, options->match_limit);
+
+    uint64_t total_ns = 0, captures = 0, limit_hits = 0;
+    size_t n = 0;
+    for (unsigned round = 0; round < options->warmup + options->iterations; round++) {
+        bool measured = round >= options->warmup;
+        for (size_t i = 0; i < corpus->count; i++) {
+            uint64_t count = 0;
+            uint64_t start = bench_now_ns();
+            ts_query_cursor_exec(cursor, query, ts_tree_root_node(trees[i]));
+            TSQueryMatch match;
+            uint32_t index;
+            while (ts_query_cursor_next_capture(cursor, &match, &index)) {
+                count++;
+            }
+            uint64_t elapsed = bench_now_ns() - start;
+            if (measured) {
+                samples[n++] = elapsed;
+                total_ns += elapsed;
+                captures += count;
+                limit_hits += ts_query_cursor_did_exceed_match_limit(cursor);
+            }
+        }
+    }
+
+    double seconds = (double)total_ns / 1e9;
+    double mb = (double)corpus->total_bytes * options->iterations / (1024.0 * 1024.0);
+    double captures_per_s = seconds > 0 ? (double)captures / seconds : 0;
+    double mb_per_s = seconds > 0 ? mb / seconds : 0;
+    double p50 = bench_percentile(samples, n, 50) / 1e6;
+    double p99 = bench_percentile(samples, n, 99) / 1e6;
+    uint64_t captures_per_round = captures / options->iterations;
+
+    if (options->json) {
+        printf("{\"mode\": \"query\", \"query\": \"%s\", \"patterns\": %u, \"files\": %zu"
+               ", \"iterations\": %u, \"match_limit\": %u, \"captures\": %" PRIu64
+               ", \"captures_per_s\": %.0f, \"mb_per_s\": %.3f"
+               ", \"p50_ms\": %.4f, \"p99_ms\": %.4f, \"match_limit_hits\": %" PRIu64 "}\n",
+               source->path, ts_query_pattern_count(query), corpus->count, options->iterations,
+               options->match_limit, captures_per_round, captures_per_s, mb_per_s, p50, p99,
+               limit_hits);
+    } else {
+        printf("query:       %s (%u patterns)\n", source->path, ts_query_pattern_count(query));
+        printf("captures:    %" PRIu64 " per pass, %.0f captures/s, %.2f MB/s\n",
+               captures_per_round, captures_per_s, mb_per_s);
+        printf("latency:     p50 %.3f ms, p99 %.3f ms per file\n", p50, p99);
+        printf("match limit: %u, exceeded on %" PRIu64 " of %zu cursor run(s)\n",
+               options->match_limit, limit_hits, n);
+    }
+
+    ts_query_cursor_delete(cursor);
+    ts_query_delete(query);
+    return 0;
+}
+
+int bench_query(const BenchCorpus *corpus, const BenchOptions *options) {
+    // 查询文件也按语料的方式整份读进来
+    BenchCorpus queries = {0};
+    for (size_t i = 0; i < options->query_count; i++) {
+        if (!bench_corpus_add(&queries, options->queries[i])) {
+            bench_corpus_free(&queries);
+            return 1;
+        }
+    }
+    TSParser *parser = bench_parser_new();
+    if (!parser) {
+        bench_corpus_free(&queries);
+        return 1;
+    }
+
+    TSTree **trees = calloc(corpus->count ? corpus->count : 1, sizeof(TSTree *));
+    size_t sample_count = corpus->count * options->iterations;
+    uint64_t *samples = malloc((sample_count ? sample_count : 1) * sizeof(uint64_t));
+    int status = 0;
+    for (size_t i = 0; i < corpus->count; i++) {
+        const BenchFile *file = &corpus->files[i];
+        trees[i] = ts_parser_parse_string(parser, NULL, file->data, file->length);
+    }
+    for (size_t q = 0; status == 0 && q < queries.count; q++) {
+        if (q > 0 && !options->json) {
+            printf("\n");
+        }
+        status = run_query(&queries.files[q], trees, corpus, options, samples);
+    }
+
+    for (size_t i = 0; i < corpus->count; i++) {
+        ts_tree_delete(trees[i]);
+    }
+    free(trees);
+    free(samples);
+    ts_parser_delete(parser);
+    bench_corpus_free(&queries);
+    return status;
+}
@@ -0,0 +1,127 @@
+// stream.c
+// 流式模式：把语料（没给语料时用合成的生成文件）反复拼接进一个约 --stream-mb MB 的临时文件，
+// 用 tree_sitter_vim9_parse_stream() 按 --chunk KB 切块解析，报告吞吐、块数、最大块和峰值 RSS。
+// 峰值 RSS 应当只跟块大小和线程数有关，不随文件大小增长。
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+
+#include <tree_sitter/tree-sitter-vim9-stream.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint64_t chunks;
+    uint64_t nodes;
+    uint32_t max_chunk;
+    uint64_t error_chunks;
+} StreamStats;
+
+// 多线程时回调一次只进一个，不用加锁
+static bool count_chunk(void *payload, const TSTree *tree, const TreeSitterVim9Chunk *chunk) {
+    StreamStats *stats = payload;
+    TSNode root = ts_tree_root_node(tree);
+    stats->chunks++;
+    stats->nodes += ts_node_descendant_count(root);
+    if (chunk->length > stats->max_chunk) {
+        stats->max_chunk = chunk->length;
+    }
+    if (ts_node_has_error(root)) {
+        stats->error_chunks++;
+    }
+    return true;
+}
+
+// 合成的生成文件片段：highlight 表、多行 dict、短 def
+static void write_synthetic(FILE *file, unsigned index) {
+    fprintf(file, "highlight Group%u guifg=#%06x guibg=NONE gui=bold ctermfg=%u\n", index,
+            index * 2654435761u & 0xffffff, index % 256);
+    fprintf(file, "g:table_%u = {\n  name: 'item%u',\n  values: [%u, %u, %u],\n"
+                  "  nested: {a: [1, 2], b: 'x'},\n}\n",
+            index, index, index, index + 1, index + 2);
+    fprintf(file, "def Generated%u(x: number): number\n  if x > %u\n    return x - 1\n"
+                  "  endif\n  return x\nenddef\n",
+            index, index);
+}
+
+static FILE *make_input(const BenchCorpus *corpus, uint64_t target, uint64_t *bytes) {
+    FILE *file = tmpfile();
+    if (!file) {
+        perror("tmpfile");
+        return NULL;
+    }
+    fputs("vim9script\n", file);
+    for (unsigned i = 0; (uint64_t)ftell(file) < target; i++) {
+        if (corpus->count) {
+            const BenchFile *source = &corpus->files[i % corpus->count];
+            fwrite(source->data, 1, source->length, file);
+            if (source->length && source->data[source->length - 1] != '\n') {
+                fputc('\n', file);
+            }
+        } else {
+            write_synthetic(file, i);
+        }
+    }
+    *bytes = (uint64_t)ftell(file);
+    if (fflush(file) != 0) {
+        perror("tmpfile");
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+int bench_stream(const BenchCorpus *corpus, const BenchOptions *options) {
+    uint64_t bytes;
+    FILE *file = make_input(corpus, (uint64_t)options->stream_mb << 20, &bytes);
+    if (!file) {
+        return 1;
+    }
+    TreeSitterVim9StreamOptions stream = {options->chunk_kb << 10, options->threads};
+
+    StreamStats stats = {0};
+    uint64_t total_ns = 0;
+    for (unsigned round = 0; round < options->warmup + options->iterations; round++) {
+        rewind(file);
+        stats = (StreamStats){0};
+        uint64_t start = bench_now_ns();
+        int status = tree_sitter_vim9_parse_stream(file, &stream, count_chunk, &stats);
+        uint64_t elapsed = bench_now_ns() - start;
+        if (status) {
+            fprintf(stderr, "stream parse failed: %s\n", strerror(status));
+            fclose(file);
+            return 1;
+        }
+        if (round >= options->warmup) {
+            total_ns += elapsed;
+        }
+    }
+    fclose(file);
+
+    double seconds = (double)total_ns / 1e9;
+    double mb = (double)bytes * options->iterations / (1024.0 * 1024.0);
+    double mb_per_s = seconds > 0 ? mb / seconds : 0;
+    double rss_mb = (double)bench_peak_rss_bytes() / (1024.0 * 1024.0);
+    if (options->json) {
+        printf("{\"mode\": \"stream\", \"bytes\": %" PRIu64 ", \"iterations\": %u"
+               ", \"chunk_kb\": %u, \"threads\": %u, \"mb_per_s\": %.3f, \"chunks\": %" PRIu64
+               ", \"max_chunk_bytes\": %u, \"nodes\": %" PRIu64 ", \"error_chunks\": %" PRIu64
+               ", \"peak_rss_mb\": %.2f}\n",
+               bytes, options->iterations, options->chunk_kb, options->threads, mb_per_s,
+               stats.chunks, stats.max_chunk, stats.nodes, stats.error_chunks, rss_mb);
+    } else {
+        printf("input:       %s, %" PRIu64 " bytes x %u iterations\n",
+               corpus->count ? "concatenated corpus" : "synthesized", bytes, options->iterations);
+        printf("chunks:      %" PRIu64 " (target %u KB, largest %u bytes), %u thread(s)\n",
+               stats.chunks, options->chunk_kb, stats.max_chunk,
+               options->threads ? options->threads : 1);
+        printf("throughput:  %.2f MB/s, %" PRIu64 " nodes per pass\n", mb_per_s, stats.nodes);
+        printf("peak rss:    %.1f MB\n", rss_mb);
+        printf("errors:      %" PRIu64 " chunk(s)\n", stats.error_chunks);
+    }
+    return 0;
+}
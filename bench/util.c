@@ -0,0 +1,172 @@
+// util.c
+// 语料加载与计时工具。
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bench.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static bool has_suffix(const char *s, const char *suffix) {
+    size_t n = strlen(s), m = strlen(suffix);
+    return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static bool load_file(BenchCorpus *corpus, const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (length < 0 || (unsigned long)length > UINT32_MAX) {
+        fprintf(stderr, "%s: unsupported file size\n", path);
+        fclose(f);
+        return false;
+    }
+
+    char *data = malloc((size_t)length + 1);
+    if (!data || fread(data, 1, (size_t)length, f) != (size_t)length) {
+        fprintf(stderr, "%s: read failed\n", path);
+        free(data);
+        fclose(f);
+        return false;
+    }
+    data[length] = '\0';
+    fclose(f);
+
+    if (corpus->count == corpus->capacity) {
+        corpus->capacity = corpus->capacity ? corpus->capacity * 2 : 16;
+        corpus->files = realloc(corpus->files, corpus->capacity * sizeof(BenchFile));
+    }
+    corpus->files[corpus->count++] = (BenchFile){
+        .path = strdup(path),
+        .data = data,
+        .length = (uint32_t)length,
+    };
+    corpus->total_bytes += (uint64_t)length;
+    return true;
+}
+
+static bool load_dir(BenchCorpus *corpus, const char *path) {
+    DIR *dir = opendir(path);
+    if (!dir) {
+        perror(path);
+        return false;
+    }
+
+    char **names = NULL;
+    size_t count = 0, capacity = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            names = realloc(names, capacity * sizeof(char *));
+        }
+        names[count++] = strdup(entry->d_name);
+    }
+    closedir(dir);
+    qsort(names, count, sizeof(char *), compare_names);
+
+    bool ok = true;
+    for (size_t i = 0; i < count; i++) {
+        size_t length = strlen(path) + strlen(names[i]) + 2;
+        char *child = malloc(length);
+        snprintf(child, length, "%s/%s", path, names[i]);
+
+        struct stat st;
+        if (stat(child, &st) == 0) {
+            if (S_ISDIR(st.st_mode)) {
+                ok = load_dir(corpus, child) && ok;
+            } else if (has_suffix(child, ".vim")) {
+                ok = load_file(corpus, child) && ok;
+            }
+        }
+        free(child);
+        free(names[i]);
+    }
+    free(names);
+    return ok;
+}
+
+bool bench_corpus_add(BenchCorpus *corpus, const char *path) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        perror(path);
+        return false;
+    }
+    return S_ISDIR(st.st_mode) ? load_dir(corpus, path) : load_file(corpus, path);
+}
+
+void bench_corpus_free(BenchCorpus *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) {
+        free(corpus->files[i].path);
+        free(corpus->files[i].data);
+    }
+    free(corpus->files);
+    *corpus = (BenchCorpus){0};
+}
+
+uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 会就地排序 samples；最近秩法
+double bench_percentile(uint64_t *samples, size_t count, double p) {
+    if (count == 0) {
+        return 0;
+    }
+    qsort(samples, count, sizeof(uint64_t), compare_u64);
+    size_t rank = (size_t)(p / 100.0 * (double)count + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > count) {
+        rank = count;
+    }
+    return (double)samples[rank - 1];
+}
+
+uint64_t bench_peak_rss_bytes(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return (uint64_t)usage.ru_maxrss;
+#else
+    return (uint64_t)usage.ru_maxrss * 1024u;
+#endif
+}
+
+TSParser *bench_parser_new(void) {
+    TSParser *parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_vim9())) {
+        fprintf(stderr, "incompatible tree-sitter runtime\n");
+        ts_parser_delete(parser);
+        return NULL;
+    }
+    return parser;
+}
@@ -1,19 +1,29 @@
 {
+  "variables": {
+    # parseAsync() parses inside the addon, so it statically builds the runtime
+    # vendored by the tree-sitter package. That is a regular dependency (not an
+    # optional peer) so it is always installed, and at ^0.25 so its runtime
+    # loads ABI-15 parsers.
+    "tree_sitter_lib": "<!(node -p \"require('path').join(require('path').dirname(require.resolve('tree-sitter/package.json')), 'vendor', 'tree-sitter', 'lib')\")",
+  },
   "targets": [
     {
       "target_name": "tree_sitter_vim_binding",
       "dependencies": [
         "<!(node -p \"require('node-addon-api').targets\"):node_addon_api_except",
+        "tree_sitter_runtime",
       ],
       "include_dirs": [
         "src",
+        "bindings/c",
+        "<(tree_sitter_lib)/include",
       ],
       "sources": [
         "bindings/node/binding.cc",
         "src/parser.c",
       ],
       "variables": {
-        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")"
+        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")",
       },
       "conditions": [
         ["has_scanner=='true'", {
@@ -30,6 +40,29 @@
           ],
         }],
       ],
+    },
+    {
+      "target_name": "tree_sitter_runtime",
+      "type": "static_library",
+      "include_dirs": [
+        "<(tree_sitter_lib)/include",
+        "<(tree_sitter_lib)/src",
+      ],
+      "sources": [
+        "<(tree_sitter_lib)/src/lib.c",
+      ],
+      "conditions": [
+        ["OS!='win'", {
+          "cflags_c": [
+            "-std=c11",
+          ],
+        }, { # OS == "win"
+          "cflags_c": [
+            "/std:c11",
+            "/utf-8",
+          ],
+        }],
+      ],
     }
   ]
 }
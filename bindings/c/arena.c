@@ -0,0 +1,221 @@
+#include "tree_sitter/tree-sitter-vim9.h"
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define ARENA_THREAD_LOCAL __declspec(thread)
+#else
+#define ARENA_THREAD_LOCAL _Thread_local
+#endif
+
+#define ARENA_DEFAULT_CHUNK_SIZE ((size_t)1 << 20)
+
+// Every block starts with its size so realloc knows how much to copy.
+#define ARENA_HEADER (alignof(max_align_t) > sizeof(size_t) ? alignof(max_align_t) : sizeof(size_t))
+
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t capacity;
+    size_t used;
+    alignas(max_align_t) char data[];
+} ArenaChunk;
+
+struct TreeSitterVim9Arena {
+    ArenaChunk *chunks;  // newest first; only the newest one is bumped
+    size_t chunk_size;
+    size_t used;
+    size_t peak;
+    char *last;  // most recent block, which free/realloc can give back
+};
+
+static ARENA_THREAD_LOCAL TreeSitterVim9Arena *current_arena;
+
+static ArenaChunk *chunk_new(size_t capacity) {
+    ArenaChunk *chunk = malloc(offsetof(ArenaChunk, data) + capacity);
+    if (chunk) {
+        chunk->next = NULL;
+        chunk->capacity = capacity;
+        chunk->used = 0;
+    }
+    return chunk;
+}
+
+TreeSitterVim9Arena *tree_sitter_vim9_arena_new(size_t chunk_size) {
+    TreeSitterVim9Arena *arena = calloc(1, sizeof(TreeSitterVim9Arena));
+    if (arena) {
+        arena->chunk_size = chunk_size ? chunk_size : ARENA_DEFAULT_CHUNK_SIZE;
+    }
+    return arena;
+}
+
+static void arena_free_chunks(ArenaChunk *chunk) {
+    while (chunk) {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+}
+
+void tree_sitter_vim9_arena_delete(TreeSitterVim9Arena *arena) {
+    if (!arena) {
+        return;
+    }
+    if (current_arena == arena) {
+        current_arena = NULL;
+    }
+    arena_free_chunks(arena->chunks);
+    free(arena);
+}
+
+void tree_sitter_vim9_arena_reset(TreeSitterVim9Arena *arena) {
+    // A job that spilled into several chunks gets one chunk big enough for
+    // all of it next time, so a steady workload stops calling malloc at all.
+    if (arena->chunks && arena->chunks->next) {
+        size_t total = 0;
+        for (ArenaChunk *chunk = arena->chunks; chunk; chunk = chunk->next) {
+            total += chunk->capacity;
+        }
+        arena_free_chunks(arena->chunks);
+        arena->chunks = chunk_new(total);
+    } else if (arena->chunks) {
+        arena->chunks->used = 0;
+    }
+    arena->used = 0;
+    arena->last = NULL;
+}
+
+TreeSitterVim9Arena *tree_sitter_vim9_arena_enter(TreeSitterVim9Arena *arena) {
+    TreeSitterVim9Arena *previous = current_arena;
+    current_arena = arena;
+    return previous;
+}
+
+size_t tree_sitter_vim9_arena_peak(const TreeSitterVim9Arena *arena) {
+    return arena->peak;
+}
+
+static size_t round_up(size_t size) {
+    size_t align = ARENA_HEADER;
+    return (size + align - 1) / align * align;
+}
+
+static bool arena_owns(const TreeSitterVim9Arena *arena, const void *ptr) {
+    const char *p = ptr;
+    for (const ArenaChunk *chunk = arena->chunks; chunk; chunk = chunk->next) {
+        if (p > chunk->data && p < chunk->data + chunk->used) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t block_size(const void *ptr) {
+    size_t size;
+    memcpy(&size, (const char *)ptr - ARENA_HEADER, sizeof(size));
+    return size;
+}
+
+static void *arena_alloc(TreeSitterVim9Arena *arena, size_t size) {
+    if (size > SIZE_MAX / 2) {
+        return NULL;
+    }
+    size_t needed = ARENA_HEADER + round_up(size ? size : 1);
+    ArenaChunk *chunk = arena->chunks;
+    if (!chunk || chunk->capacity - chunk->used < needed) {
+        size_t capacity = arena->chunk_size;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        chunk = chunk_new(capacity);
+        if (!chunk) {
+            return NULL;
+        }
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    char *block = chunk->data + chunk->used + ARENA_HEADER;
+    memcpy(block - ARENA_HEADER, &size, sizeof(size));
+    chunk->used += needed;
+    arena->used += needed;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    arena->last = block;
+    return block;
+}
+
+void *tree_sitter_vim9_arena_malloc(size_t size) {
+    TreeSitterVim9Arena *arena = current_arena;
+    return arena ? arena_alloc(arena, size) : malloc(size);
+}
+
+void *tree_sitter_vim9_arena_calloc(size_t count, size_t size) {
+    TreeSitterVim9Arena *arena = current_arena;
+    if (!arena) {
+        return calloc(count, size);
+    }
+    if (size && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    // Reused chunks are not zeroed, so this has to clear explicitly.
+    void *ptr = arena_alloc(arena, count * size);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void *tree_sitter_vim9_arena_realloc(void *ptr, size_t size) {
+    TreeSitterVim9Arena *arena = current_arena;
+    if (!arena || (ptr && !arena_owns(arena, ptr))) {
+        return realloc(ptr, size);
+    }
+    if (!ptr) {
+        return arena_alloc(arena, size);
+    }
+    size_t old_size = block_size(ptr);
+    // The newest block grows in place while there is room behind it; this is
+    // the common case for the runtime's growing arrays.
+    ArenaChunk *chunk = arena->chunks;
+    if (ptr == arena->last) {
+        size_t old_needed = round_up(old_size ? old_size : 1);
+        size_t new_needed = round_up(size ? size : 1);
+        if (new_needed <= old_needed || new_needed - old_needed <= chunk->capacity - chunk->used) {
+            chunk->used = chunk->used - old_needed + new_needed;
+            arena->used = arena->used - old_needed + new_needed;
+            if (arena->used > arena->peak) {
+                arena->peak = arena->used;
+            }
+            memcpy((char *)ptr - ARENA_HEADER, &size, sizeof(size));
+            return ptr;
+        }
+    }
+    void *moved = arena_alloc(arena, size);
+    if (moved) {
+        memcpy(moved, ptr, old_size < size ? old_size : size);
+    }
+    return moved;
+}
+
+void tree_sitter_vim9_arena_free(void *ptr) {
+    TreeSitterVim9Arena *arena = current_arena;
+    if (!ptr) {
+        return;
+    }
+    if (!arena || !arena_owns(arena, ptr)) {
+        free(ptr);
+        return;
+    }
+    // Everything else waits for tree_sitter_vim9_arena_reset().
+    if (ptr == arena->last) {
+        size_t needed = ARENA_HEADER + round_up(block_size(ptr) ? block_size(ptr) : 1);
+        arena->chunks->used -= needed;
+        arena->used -= needed;
+        arena->last = NULL;
+    }
+}
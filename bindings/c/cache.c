@@ -0,0 +1,463 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "tree_sitter/tree-sitter-vim9.h"
+#include "tree_sitter/parser.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// File layout, all integers in the writer's byte order (checked through
+// `byte_order`):
+//
+//     CacheHeader
+//     CacheRecord[record_count]   sorted by (hash, length)
+//     per record at `offset`: kind[count] flags[count], padded to 4 bytes,
+//                             then parent and the seven uint32 columns
+#define CACHE_MAGIC "TSV9OUTL"
+#define CACHE_FORMAT_VERSION 1
+#define CACHE_BYTE_ORDER 0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t byte_order;
+    uint32_t language_version;
+    uint8_t grammar_version[4];  // major, minor, patch, 0
+    uint64_t grammar_fingerprint;
+    uint64_t file_size;
+    uint32_t record_count;
+    uint32_t reserved;
+} CacheHeader;
+
+typedef struct {
+    uint64_t hash;
+    uint32_t length;
+    uint32_t count;
+    uint32_t node_count;
+    uint32_t flags;
+    uint64_t offset;
+} CacheRecord;
+
+#define CACHE_RECORD_HAS_ERROR 0x1
+
+struct TreeSitterVim9Cache {
+    const char *data;
+    size_t size;
+    const CacheRecord *records;
+    uint32_t record_count;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+};
+
+struct TreeSitterVim9CacheWriter {
+    CacheRecord *records;
+    uint32_t record_count;
+    uint32_t record_capacity;
+    char *data;  // columns; record offsets are relative to this until commit
+    size_t length;
+    size_t capacity;
+};
+
+// MurmurHash64A
+uint64_t tree_sitter_vim9_hash(const void *data, size_t length) {
+    const uint64_t m = 0xc6a4a7935bd1e995ull;
+    const unsigned char *p = data;
+    uint64_t h = 0x9e3779b97f4a7c15ull ^ ((uint64_t)length * m);
+    for (; length >= 8; p += 8, length -= 8) {
+        uint64_t k;
+        memcpy(&k, p, sizeof(k));
+        k *= m;
+        k ^= k >> 47;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    switch (length) {
+        case 7: h ^= (uint64_t)p[6] << 48; // fallthrough
+        case 6: h ^= (uint64_t)p[5] << 40; // fallthrough
+        case 5: h ^= (uint64_t)p[4] << 32; // fallthrough
+        case 4: h ^= (uint64_t)p[3] << 24; // fallthrough
+        case 3: h ^= (uint64_t)p[2] << 16; // fallthrough
+        case 2: h ^= (uint64_t)p[1] << 8;  // fallthrough
+        case 1: h ^= (uint64_t)p[0]; h *= m;
+    }
+    h ^= h >> 47;
+    h *= m;
+    h ^= h >> 47;
+    return h;
+}
+
+static uint64_t hash_string(uint64_t h, const char *s) {
+    return tree_sitter_vim9_hash(s, strlen(s)) ^ (h * 0x100000001b3ull);
+}
+
+// The grammar version in tree-sitter.json is rarely bumped, so the table
+// sizes and every symbol and field name go into the key as well: any change
+// that could move or rename a declaration invalidates old caches.
+static uint64_t grammar_fingerprint(const TSLanguage *language) {
+    const uint32_t counts[] = {
+        language->symbol_count,       language->alias_count,
+        language->token_count,        language->external_token_count,
+        language->state_count,        language->large_state_count,
+        language->production_id_count, language->field_count,
+    };
+    uint64_t h = tree_sitter_vim9_hash(counts, sizeof(counts));
+    for (uint32_t i = 0; i < language->symbol_count + language->alias_count; i++) {
+        h = hash_string(h, language->symbol_names[i]);
+    }
+    for (uint32_t i = 1; i <= language->field_count; i++) {
+        h = hash_string(h, language->field_names[i]);
+    }
+    return h;
+}
+
+static void header_init(CacheHeader *header) {
+    const TSLanguage *language = tree_sitter_vim9();
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, CACHE_MAGIC, sizeof(header->magic));
+    header->format_version = CACHE_FORMAT_VERSION;
+    header->byte_order = CACHE_BYTE_ORDER;
+    header->language_version = language->abi_version;
+    header->grammar_version[0] = language->metadata.major_version;
+    header->grammar_version[1] = language->metadata.minor_version;
+    header->grammar_version[2] = language->metadata.patch_version;
+    header->grammar_fingerprint = grammar_fingerprint(language);
+}
+
+// kind and flags, padded so the 32-bit columns after them stay aligned
+static size_t byte_columns_size(uint32_t count) {
+    return (2 * (size_t)count + 3) / 4 * 4;
+}
+
+static size_t columns_size(uint32_t count) {
+    return byte_columns_size(count) + 8 * sizeof(uint32_t) * (size_t)count;
+}
+
+static bool cache_valid(const TreeSitterVim9Cache *cache) {
+    CacheHeader expected, header;
+    if (cache->size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, cache->data, sizeof(header));
+    header_init(&expected);
+    expected.file_size = cache->size;
+    expected.record_count = header.record_count;
+    if (memcmp(&header, &expected, sizeof(header)) != 0) {
+        return false;
+    }
+    return (cache->size - sizeof(header)) / sizeof(CacheRecord) >= header.record_count;
+}
+
+static void cache_unmap(TreeSitterVim9Cache *cache) {
+#ifdef _WIN32
+    UnmapViewOfFile(cache->data);
+    CloseHandle(cache->mapping);
+#else
+    munmap((void *)cache->data, cache->size);
+#endif
+}
+
+TreeSitterVim9Cache *tree_sitter_vim9_cache_open(const char *path) {
+    TreeSitterVim9Cache *cache = calloc(1, sizeof(TreeSitterVim9Cache));
+    if (!cache) {
+        errno = ENOMEM;
+        return NULL;
+    }
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+    if (handle == INVALID_HANDLE_VALUE) {
+        free(cache);
+        errno = ENOENT;
+        return NULL;
+    }
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart < (LONGLONG)sizeof(CacheHeader)) {
+        CloseHandle(handle);
+        free(cache);
+        errno = EINVAL;
+        return NULL;
+    }
+    cache->mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    const void *view =
+        cache->mapping ? MapViewOfFile(cache->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!view) {
+        if (cache->mapping) {
+            CloseHandle(cache->mapping);
+        }
+        free(cache);
+        errno = EIO;
+        return NULL;
+    }
+    cache->data = view;
+    cache->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0) {
+        free(cache);
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(CacheHeader)) {
+        close(fd);
+        free(cache);
+        errno = EINVAL;
+        return NULL;
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        free(cache);
+        return NULL;
+    }
+    cache->data = data;
+    cache->size = (size_t)st.st_size;
+#endif
+    if (!cache_valid(cache)) {
+        cache_unmap(cache);
+        free(cache);
+        errno = EINVAL;
+        return NULL;
+    }
+    // The header is 8-byte aligned and the mapping page aligned, so the
+    // records can be read in place.
+    cache->records = (const CacheRecord *)(cache->data + sizeof(CacheHeader));
+    cache->record_count = ((const CacheHeader *)cache->data)->record_count;
+    return cache;
+}
+
+void tree_sitter_vim9_cache_close(TreeSitterVim9Cache *cache) {
+    if (cache) {
+        cache_unmap(cache);
+        free(cache);
+    }
+}
+
+uint32_t tree_sitter_vim9_cache_count(const TreeSitterVim9Cache *cache) {
+    return cache ? cache->record_count : 0;
+}
+
+static int record_compare(uint64_t hash, uint32_t length, const CacheRecord *record) {
+    if (hash != record->hash) {
+        return hash < record->hash ? -1 : 1;
+    }
+    return length == record->length ? 0 : length < record->length ? -1 : 1;
+}
+
+// Copies `count` elements of `size` bytes out of the record's columns and
+// advances `*at` past them.
+static void read_column(void *column, const char **at, uint32_t count, size_t size) {
+    if (count > 0) {
+        memcpy(column, *at, count * size);
+    }
+    *at += count * size;
+}
+
+bool tree_sitter_vim9_cache_get(const TreeSitterVim9Cache *cache, uint64_t hash,
+                                uint32_t length, TreeSitterVim9Outline *outline,
+                                TreeSitterVim9CacheInfo *info) {
+    if (!cache) {
+        return false;
+    }
+    const CacheRecord *record = NULL;
+    uint32_t low = 0, high = cache->record_count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        int order = record_compare(hash, length, &cache->records[middle]);
+        if (order == 0) {
+            record = &cache->records[middle];
+            break;
+        }
+        if (order < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    // A record pointing outside the file is treated as a miss, not trusted.
+    if (!record || record->offset > cache->size ||
+        columns_size(record->count) > cache->size - record->offset ||
+        !tree_sitter_vim9_outline_reserve(outline, record->count)) {
+        return false;
+    }
+    const char *at = cache->data + record->offset;
+    uint32_t count = record->count;
+    read_column(outline->kind, &at, count, sizeof(uint8_t));
+    read_column(outline->flags, &at, count, sizeof(uint8_t));
+    at = cache->data + record->offset + byte_columns_size(count);
+    read_column(outline->parent, &at, count, sizeof(int32_t));
+    read_column(outline->name_start, &at, count, sizeof(uint32_t));
+    read_column(outline->name_end, &at, count, sizeof(uint32_t));
+    read_column(outline->start_row, &at, count, sizeof(uint32_t));
+    read_column(outline->start_column, &at, count, sizeof(uint32_t));
+    read_column(outline->end_row, &at, count, sizeof(uint32_t));
+    read_column(outline->end_column, &at, count, sizeof(uint32_t));
+    outline->count = count;
+    if (info) {
+        info->node_count = record->node_count;
+        info->has_error = record->flags & CACHE_RECORD_HAS_ERROR;
+    }
+    return true;
+}
+
+TreeSitterVim9CacheWriter *tree_sitter_vim9_cache_writer_new(void) {
+    return calloc(1, sizeof(TreeSitterVim9CacheWriter));
+}
+
+void tree_sitter_vim9_cache_writer_delete(TreeSitterVim9CacheWriter *writer) {
+    if (writer) {
+        free(writer->records);
+        free(writer->data);
+        free(writer);
+    }
+}
+
+static void write_column(char **at, const void *column, uint32_t count, size_t size) {
+    if (count > 0) {
+        memcpy(*at, column, count * size);
+    }
+    *at += count * size;
+}
+
+bool tree_sitter_vim9_cache_writer_add(TreeSitterVim9CacheWriter *writer, uint64_t hash,
+                                       uint32_t length, const TreeSitterVim9Outline *outline,
+                                       const TreeSitterVim9CacheInfo *info) {
+    if (writer->record_count == writer->record_capacity) {
+        uint32_t capacity = writer->record_capacity ? writer->record_capacity * 2 : 256;
+        CacheRecord *records = realloc(writer->records, capacity * sizeof(CacheRecord));
+        if (!records) {
+            return false;
+        }
+        writer->records = records;
+        writer->record_capacity = capacity;
+    }
+    uint32_t count = outline->count;
+    size_t size = columns_size(count);
+    if (writer->capacity - writer->length < size) {
+        size_t capacity = writer->capacity ? writer->capacity : 64 * 1024;
+        while (capacity - writer->length < size) {
+            capacity *= 2;
+        }
+        char *data = realloc(writer->data, capacity);
+        if (!data) {
+            return false;
+        }
+        writer->data = data;
+        writer->capacity = capacity;
+    }
+
+    char *start = writer->data + writer->length;
+    char *at = start;
+    write_column(&at, outline->kind, count, sizeof(uint8_t));
+    write_column(&at, outline->flags, count, sizeof(uint8_t));
+    // zeroed padding keeps the file byte-for-byte reproducible
+    if (count > 0) {
+        memset(at, 0, (size_t)(start + byte_columns_size(count) - at));
+    }
+    at = start + byte_columns_size(count);
+    write_column(&at, outline->parent, count, sizeof(int32_t));
+    write_column(&at, outline->name_start, count, sizeof(uint32_t));
+    write_column(&at, outline->name_end, count, sizeof(uint32_t));
+    write_column(&at, outline->start_row, count, sizeof(uint32_t));
+    write_column(&at, outline->start_column, count, sizeof(uint32_t));
+    write_column(&at, outline->end_row, count, sizeof(uint32_t));
+    write_column(&at, outline->end_column, count, sizeof(uint32_t));
+
+    CacheRecord *record = &writer->records[writer->record_count++];
+    memset(record, 0, sizeof(*record));
+    record->hash = hash;
+    record->length = length;
+    record->count = count;
+    record->node_count = info ? info->node_count : 0;
+    record->flags = info && info->has_error ? CACHE_RECORD_HAS_ERROR : 0;
+    record->offset = writer->length;
+    writer->length += size;
+    return true;
+}
+
+static int record_order(const void *a, const void *b) {
+    const CacheRecord *record = b;
+    int order = record_compare(((const CacheRecord *)a)->hash, ((const CacheRecord *)a)->length,
+                               record);
+    if (order == 0) {
+        // equal keys: keep the earlier one first so deduplication is stable
+        const CacheRecord *left = a;
+        return left->offset < record->offset ? -1 : left->offset > record->offset;
+    }
+    return order;
+}
+
+bool tree_sitter_vim9_cache_writer_commit(TreeSitterVim9CacheWriter *writer, const char *path) {
+    if (writer->record_count > 0) {
+        qsort(writer->records, writer->record_count, sizeof(CacheRecord), record_order);
+    }
+    // Identical files (same hash and length) share one record.
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < writer->record_count; i++) {
+        if (unique == 0 || record_compare(writer->records[i].hash, writer->records[i].length,
+                                          &writer->records[unique - 1]) != 0) {
+            writer->records[unique++] = writer->records[i];
+        }
+    }
+    writer->record_count = unique;
+
+    CacheHeader header;
+    header_init(&header);
+    uint64_t data_offset = sizeof(header) + (uint64_t)unique * sizeof(CacheRecord);
+    header.record_count = unique;
+    header.file_size = data_offset + writer->length;
+
+    size_t path_length = strlen(path);
+    char *temporary = malloc(path_length + sizeof(".tmp"));
+    if (!temporary) {
+        errno = ENOMEM;
+        return false;
+    }
+    memcpy(temporary, path, path_length);
+    memcpy(temporary + path_length, ".tmp", sizeof(".tmp"));
+
+    FILE *file = fopen(temporary, "wb");
+    bool ok = file != NULL;
+    if (ok) {
+        ok = fwrite(&header, sizeof(header), 1, file) == 1;
+        for (uint32_t i = 0; ok && i < unique; i++) {
+            CacheRecord record = writer->records[i];
+            record.offset += data_offset;
+            ok = fwrite(&record, sizeof(record), 1, file) == 1;
+        }
+        if (ok && writer->length > 0) {
+            ok = fwrite(writer->data, writer->length, 1, file) == 1;
+        }
+        ok = fclose(file) == 0 && ok;
+    }
+#ifdef _WIN32
+    ok = ok && MoveFileExA(temporary, path, MOVEFILE_REPLACE_EXISTING);
+#else
+    ok = ok && rename(temporary, path) == 0;
+#endif
+    if (!ok) {
+        int error = errno;
+        remove(temporary);
+        errno = error;
+    }
+    free(temporary);
+    return ok;
+}
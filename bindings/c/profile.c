@@ -0,0 +1,268 @@
+// TREE_SITTER_PROFILE builds compile this file instead of src/parser.c: it
+// swaps the lexer macros for counting versions and then includes the
+// generated parser, so neither parser.c nor parser.h has to be touched when
+// the parser is regenerated.
+
+#include "tree_sitter/tree-sitter-vim9.h"
+#include "tree_sitter/parser.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PROFILE_THREAD_LOCAL __declspec(thread)
+#else
+#define PROFILE_THREAD_LOCAL _Thread_local
+#endif
+
+// Per lex function (ts_lex and ts_lex_keywords number their states
+// independently), indexed by lex state.
+typedef struct {
+    const char *name;
+    uint64_t calls;
+    uint64_t *visits;
+    uint64_t *map_scans;  // ADVANCE_MAP and ADVANCE_TABLE lookups made in the state
+    uint64_t *map_steps;  // entries those lookups compared (one per table lookup)
+    uint32_t capacity;
+} ProfileLexer;
+
+typedef struct {
+    ProfileLexer lexers[2];
+    uint64_t advances;
+    uint64_t skips;
+    uint64_t *tokens;  // accepted tokens by symbol
+} Profile;
+
+static PROFILE_THREAD_LOCAL Profile profile;
+
+// `name` is the lex function's __func__, which has a fixed address, so the
+// lookup is a pointer compare.
+static ProfileLexer *profile_lexer(const char *name) {
+    for (size_t i = 0; i < sizeof(profile.lexers) / sizeof(profile.lexers[0]); i++) {
+        ProfileLexer *lexer = &profile.lexers[i];
+        if (lexer->name == name || !lexer->name) {
+            lexer->name = name;
+            lexer->calls++;
+            return lexer;
+        }
+    }
+    return NULL;
+}
+
+static bool profile_grow(ProfileLexer *lexer, uint32_t state) {
+    uint32_t capacity = lexer->capacity ? lexer->capacity : 256;
+    while (capacity <= state) {
+        capacity *= 2;
+    }
+    uint64_t **arrays[] = {&lexer->visits, &lexer->map_scans, &lexer->map_steps};
+    for (size_t i = 0; i < sizeof(arrays) / sizeof(arrays[0]); i++) {
+        uint64_t *grown = realloc(*arrays[i], capacity * sizeof(uint64_t));
+        if (!grown) {
+            return false;
+        }
+        memset(grown + lexer->capacity, 0, (capacity - lexer->capacity) * sizeof(uint64_t));
+        *arrays[i] = grown;
+    }
+    lexer->capacity = capacity;
+    return true;
+}
+
+static inline void profile_visit(ProfileLexer *lexer, uint32_t state) {
+    if (lexer && (state < lexer->capacity || profile_grow(lexer, state))) {
+        lexer->visits[state]++;
+    }
+}
+
+static inline void profile_map_scan(ProfileLexer *lexer, uint32_t state, uint32_t steps) {
+    // the state was visited first, so its slot exists
+    if (lexer && state < lexer->capacity) {
+        lexer->map_scans[state]++;
+        lexer->map_steps[state] += steps;
+    }
+}
+
+static inline void profile_advance(bool skip) {
+    if (skip) {
+        profile.skips++;
+    } else {
+        profile.advances++;
+    }
+}
+
+static inline void profile_token(bool accepted, TSSymbol symbol);
+
+#undef START_LEXER
+#define START_LEXER()                                     \
+  bool result = false;                                    \
+  bool skip = false;                                      \
+  UNUSED                                                  \
+  bool eof = false;                                       \
+  int32_t lookahead;                                      \
+  ProfileLexer *profile_lexer_state = profile_lexer(__func__); \
+  goto start;                                             \
+  next_state:                                             \
+  profile_advance(skip);                                  \
+  lexer->advance(lexer, skip);                            \
+  start:                                                  \
+  profile_visit(profile_lexer_state, state);              \
+  skip = false;                                           \
+  lookahead = lexer->lookahead;
+
+#undef ADVANCE_MAP
+#define ADVANCE_MAP(...)                                                      \
+  {                                                                           \
+    static const uint16_t map[] = { __VA_ARGS__ };                            \
+    uint32_t i = 0;                                                           \
+    for (; i < sizeof(map) / sizeof(map[0]); i += 2) {                        \
+      if (map[i] == lookahead) {                                              \
+        profile_map_scan(profile_lexer_state, state, i / 2 + 1);              \
+        state = map[i + 1];                                                   \
+        goto next_state;                                                      \
+      }                                                                       \
+    }                                                                         \
+    profile_map_scan(profile_lexer_state, state, i / 2);                      \
+  }
+
+// The dense tables vim9-lexmap writes; parser.c only defines the plain
+// version when this one isn't there.
+#define ADVANCE_TABLE(map)                                    \
+  {                                                           \
+    profile_map_scan(profile_lexer_state, state, 1);          \
+    if (map[lookahead]) ADVANCE(map[lookahead] - 1);          \
+  }
+
+#undef END_STATE
+#define END_STATE()                              \
+  do {                                           \
+    profile_token(result, lexer->result_symbol); \
+    return result;                               \
+  } while (0)
+
+#include "parser.c"
+
+static inline void profile_token(bool accepted, TSSymbol symbol) {
+    if (!accepted || symbol >= SYMBOL_COUNT) {
+        return;
+    }
+    if (!profile.tokens && !(profile.tokens = calloc(SYMBOL_COUNT, sizeof(uint64_t)))) {
+        return;
+    }
+    profile.tokens[symbol]++;
+}
+
+void tree_sitter_vim9_profile_reset(void) {
+    for (size_t i = 0; i < sizeof(profile.lexers) / sizeof(profile.lexers[0]); i++) {
+        ProfileLexer *lexer = &profile.lexers[i];
+        free(lexer->visits);
+        free(lexer->map_scans);
+        free(lexer->map_steps);
+    }
+    free(profile.tokens);
+    memset(&profile, 0, sizeof(profile));
+}
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} ProfileBuffer;
+
+static void buffer_printf(ProfileBuffer *buffer, const char *format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        size_t room = buffer->capacity - buffer->length;
+        int written = vsnprintf(buffer->data ? buffer->data + buffer->length : NULL, room, format,
+                                args);
+        va_end(args);
+        if (written < 0) {
+            buffer->failed = true;
+            return;
+        }
+        if ((size_t)written < room) {
+            buffer->length += (size_t)written;
+            return;
+        }
+        size_t capacity = buffer->capacity ? buffer->capacity * 2 : 4096;
+        while (capacity - buffer->length <= (size_t)written) {
+            capacity *= 2;
+        }
+        char *grown = realloc(buffer->data, capacity);
+        if (!grown) {
+            buffer->failed = true;
+            return;
+        }
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+}
+
+static void buffer_json_string(ProfileBuffer *buffer, const char *s) {
+    buffer_printf(buffer, "\"");
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            buffer_printf(buffer, "\\%c", c);
+        } else if (c < 0x20) {
+            buffer_printf(buffer, "\\u%04x", c);
+        } else {
+            buffer_printf(buffer, "%c", c);
+        }
+    }
+    buffer_printf(buffer, "\"");
+}
+
+char *tree_sitter_vim9_profile_json(void) {
+    ProfileBuffer buffer = {0};
+    buffer_printf(&buffer, "{\"advances\": %llu, \"skips\": %llu, \"lexers\": {",
+                  (unsigned long long)profile.advances, (unsigned long long)profile.skips);
+    bool first_lexer = true;
+    for (size_t i = 0; i < sizeof(profile.lexers) / sizeof(profile.lexers[0]); i++) {
+        const ProfileLexer *lexer = &profile.lexers[i];
+        if (!lexer->name) {
+            continue;
+        }
+        buffer_printf(&buffer, "%s", first_lexer ? "" : ", ");
+        buffer_json_string(&buffer, lexer->name);
+        buffer_printf(&buffer, ": {\"calls\": %llu, \"states\": [",
+                      (unsigned long long)lexer->calls);
+        bool first_state = true;
+        for (uint32_t state = 0; state < lexer->capacity; state++) {
+            if (!lexer->visits[state]) {
+                continue;
+            }
+            buffer_printf(&buffer,
+                          "%s{\"state\": %u, \"visits\": %llu, \"advance_map_scans\": %llu"
+                          ", \"advance_map_steps\": %llu}",
+                          first_state ? "" : ", ", state,
+                          (unsigned long long)lexer->visits[state],
+                          (unsigned long long)lexer->map_scans[state],
+                          (unsigned long long)lexer->map_steps[state]);
+            first_state = false;
+        }
+        buffer_printf(&buffer, "]}");
+        first_lexer = false;
+    }
+    buffer_printf(&buffer, "}, \"tokens\": {");
+    bool first_token = true;
+    for (TSSymbol symbol = 0; profile.tokens && symbol < SYMBOL_COUNT; symbol++) {
+        if (!profile.tokens[symbol]) {
+            continue;
+        }
+        buffer_printf(&buffer, "%s", first_token ? "" : ", ");
+        buffer_json_string(&buffer, ts_symbol_names[symbol]);
+        buffer_printf(&buffer, ": %llu", (unsigned long long)profile.tokens[symbol]);
+        first_token = false;
+    }
+    buffer_printf(&buffer, "}}");
+    if (buffer.failed) {
+        free(buffer.data);
+        return NULL;
+    }
+    return buffer.data;
+}
@@ -0,0 +1,388 @@
+#include "tree_sitter/tree-sitter-vim9.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// A command name and the shortest abbreviation Vim accepts for it.
+typedef struct {
+    const char *name;
+    uint8_t min;
+} SplitCommand;
+
+// Checked in order; "endf" is endfunction, although it is a prefix of endfor too.
+static const SplitCommand block_openers[] = {
+    {"function", 2}, {"def", 3}, {"if", 2}, {"for", 3}, {"while", 2}, {"try", 3},
+};
+
+static const SplitCommand block_closers[] = {
+    {"enddef", 6}, {"endfor", 5}, {"endfunction", 4}, {"endwhile", 4}, {"endtry", 4},
+    {"endif", 2},
+};
+
+// The arguments of these are not expressions (keys, patterns, Ex commands):
+// brackets and quotes in them don't count. normal (checked apart) also
+// swallows '|'.
+static const SplitCommand raw_commands[] = {
+    {"map", 3},      {"nmap", 2},     {"vmap", 2},     {"xmap", 2},
+    {"smap", 4},     {"omap", 2},     {"imap", 2},     {"lmap", 2},     {"cmap", 2},
+    {"tmap", 3},     {"noremap", 2},  {"nnoremap", 2}, {"vnoremap", 2}, {"xnoremap", 2},
+    {"snoremap", 4}, {"onoremap", 3}, {"inoremap", 3}, {"lnoremap", 2}, {"cnoremap", 3},
+    {"tnoremap", 3}, {"highlight", 2}, {"syntax", 2},  {"autocmd", 2},
+};
+
+// Commands whose "<< EOF" starts a heredoc; elsewhere only "=<<" does.
+static const SplitCommand script_commands[] = {
+    {"lua", 3},  {"perl", 2},    {"ruby", 3},     {"python", 2}, {"py3", 3},
+    {"python3", 7}, {"pythonx", 7}, {"pyx", 3}, {"mzscheme", 2}, {"tcl", 2},
+};
+
+#define COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+typedef enum {
+    KIND_OTHER,
+    KIND_OPENER,
+    KIND_CLOSER,
+    KIND_RAW,
+    KIND_NORMAL,
+    KIND_SCRIPT,
+} CommandKind;
+
+static bool matches(const SplitCommand *commands, size_t count, const char *word,
+                    size_t length) {
+    for (size_t i = 0; i < count; i++) {
+        size_t name_length = strlen(commands[i].name);
+        if (length >= commands[i].min && length <= name_length &&
+            memcmp(commands[i].name, word, length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static CommandKind classify(const char *word, size_t length) {
+    if (matches(block_openers, COUNT(block_openers), word, length)) {
+        return KIND_OPENER;
+    }
+    if (matches(block_closers, COUNT(block_closers), word, length)) {
+        return KIND_CLOSER;
+    }
+    if (length >= 4 && length <= 6 && memcmp(word, "normal", length) == 0) {
+        return KIND_NORMAL;
+    }
+    if (matches(raw_commands, COUNT(raw_commands), word, length)) {
+        return KIND_RAW;
+    }
+    if (matches(script_commands, COUNT(script_commands), word, length)) {
+        return KIND_SCRIPT;
+    }
+    return KIND_OTHER;
+}
+
+static bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static bool is_word(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// Whether the text after a block word at line[i] makes it a name in an
+// expression or assignment instead (fu = 1, el->add(x), en += 3, def_x): a
+// block that is opened but never closed would keep the rest of the file in
+// one piece. A ( right after if or while is the condition's.
+static bool names_a_value(const char *line, size_t i, size_t length, bool condition) {
+    if (i < length) {
+        char c = line[i];
+        if ((c == '(' && !condition) || c == '[' || c == '.' || c == ':' || c == '#' ||
+            c == '_') {
+            return true;
+        }
+    }
+    while (i < length && is_blank(line[i])) {
+        i++;
+    }
+    if (i + 1 >= length) {
+        return false;
+    }
+    char c = line[i];
+    char next = line[i + 1];
+    switch (c) {
+        case '=':
+            return next != '=' && next != '~';
+        case '+':
+        case '*':
+        case '/':
+        case '%':
+            return next == '=';
+        case '-':
+            return next == '=' || next == '>';
+        case '.':
+            return next == '.' && i + 2 < length && line[i + 2] == '=';
+        default:
+            return false;
+    }
+}
+
+void tree_sitter_vim9_splitter_init(TreeSitterVim9Splitter *splitter) {
+    memset(splitter, 0, sizeof(*splitter));
+}
+
+void tree_sitter_vim9_splitter_consume(TreeSitterVim9Splitter *splitter, uint32_t length) {
+    if (length > splitter->boundary) {
+        length = splitter->boundary;
+    }
+    splitter->scanned -= length;
+    splitter->boundary -= length;
+}
+
+// "<< [trim] [eval] MARKER" up to the end of the line; a missing marker is ".".
+static bool heredoc_start(TreeSitterVim9Splitter *splitter, const char *line, size_t i,
+                          size_t length) {
+    bool trim = false;
+    for (;;) {
+        while (i < length && is_blank(line[i])) {
+            i++;
+        }
+        size_t start = i;
+        while (i < length && !is_blank(line[i])) {
+            i++;
+        }
+        size_t word = i - start;
+        if (word == 4 && memcmp(line + start, "trim", 4) == 0) {
+            trim = true;
+            continue;
+        }
+        if (word == 4 && memcmp(line + start, "eval", 4) == 0) {
+            continue;
+        }
+        while (i < length && is_blank(line[i])) {
+            i++;
+        }
+        if (i < length || word >= sizeof(splitter->marker)) {
+            return false;
+        }
+        if (word == 0) {
+            splitter->marker[0] = '.';
+            word = 1;
+        } else {
+            memcpy(splitter->marker, line + start, word);
+        }
+        splitter->marker_length = (uint8_t)word;
+        splitter->heredoc_trim = trim;
+        splitter->heredoc = true;
+        return true;
+    }
+}
+
+static void heredoc_line(TreeSitterVim9Splitter *splitter, const char *line, size_t length) {
+    size_t i = 0;
+    if (splitter->heredoc_trim) {
+        while (i < length && is_blank(line[i])) {
+            i++;
+        }
+    }
+    while (length > i && line[length - 1] == '\r') {
+        length--;
+    }
+    if (length - i == splitter->marker_length &&
+        memcmp(line + i, splitter->marker, splitter->marker_length) == 0) {
+        splitter->heredoc = false;
+    }
+}
+
+// One line without its newline: updates the open blocks and brackets.
+static void scan_line(TreeSitterVim9Splitter *splitter, const char *line, size_t length) {
+    if (splitter->heredoc) {
+        heredoc_line(splitter, line, length);
+        return;
+    }
+    bool command_start = true;
+    CommandKind kind = KIND_OTHER;
+    size_t i = 0;
+    while (i < length) {
+        if (command_start) {
+            while (i < length && (is_blank(line[i]) || line[i] == ':')) {
+                i++;
+            }
+            if (i == length) {
+                return;
+            }
+            // a legacy " comment, or a # comment (but #{ is a dict)
+            if (line[i] == '"' || (line[i] == '#' && (i + 1 == length || line[i + 1] != '{'))) {
+                return;
+            }
+            size_t start = i;
+            while (i < length && is_word(line[i])) {
+                i++;
+            }
+            if (i - start == 6 && memcmp(line + start, "export", 6) == 0) {
+                while (i < length && is_blank(line[i])) {
+                    i++;
+                }
+                start = i;
+                while (i < length && is_word(line[i])) {
+                    i++;
+                }
+            }
+            kind = classify(line + start, i - start);
+            if ((kind == KIND_OPENER || kind == KIND_CLOSER) &&
+                names_a_value(line, i, length, line[start] == 'i' || line[start] == 'w')) {
+                kind = KIND_OTHER;
+            }
+            if (kind == KIND_OPENER) {
+                splitter->blocks++;
+            } else if (kind == KIND_CLOSER && splitter->blocks > 0) {
+                splitter->blocks--;
+            }
+            command_start = false;
+            continue;
+        }
+
+        char c = line[i];
+        if (kind == KIND_NORMAL) {
+            return;
+        }
+        if (kind == KIND_RAW) {
+            // \| and CTRL-V | stay in the argument
+            if (c == '\\' || c == 0x16) {
+                i += 2;
+                continue;
+            }
+            if (c == '|') {
+                command_start = true;
+            }
+            i++;
+            continue;
+        }
+        switch (c) {
+            case '\'':
+                // '' is a quote inside a literal string
+                for (i++; i < length; i++) {
+                    if (line[i] == '\'') {
+                        if (i + 1 < length && line[i + 1] == '\'') {
+                            i++;
+                        } else {
+                            break;
+                        }
+                    }
+                }
+                break;
+            case '"':
+                for (i++; i < length && line[i] != '"'; i++) {
+                    if (line[i] == '\\') {
+                        i++;
+                    }
+                }
+                break;
+            case '#':
+                if (i > 0 && is_blank(line[i - 1]) && (i + 1 == length || line[i + 1] != '{')) {
+                    return;
+                }
+                break;
+            case '(':
+            case '[':
+            case '{':
+                splitter->brackets++;
+                break;
+            case ')':
+            case ']':
+            case '}':
+                if (splitter->brackets > 0) {
+                    splitter->brackets--;
+                }
+                break;
+            case '|':
+                if (i + 1 < length && line[i + 1] == '|') {
+                    i++;
+                } else if (splitter->brackets == 0) {
+                    command_start = true;
+                }
+                break;
+            case '<':
+                if (i + 1 < length && line[i + 1] == '<') {
+                    size_t before = i;
+                    while (before > 0 && is_blank(line[before - 1])) {
+                        before--;
+                    }
+                    if ((kind == KIND_SCRIPT || (before > 0 && line[before - 1] == '=')) &&
+                        heredoc_start(splitter, line, i + 2, length)) {
+                        return;
+                    }
+                    i++;
+                }
+                break;
+            default:
+                break;
+        }
+        i++;
+    }
+}
+
+// Whether the line at data[i, length) continues the one before it. Sets
+// *unknown when the answer needs more data.
+static bool continues(const char *data, uint32_t i, uint32_t length, bool at_eof,
+                      bool *unknown) {
+    *unknown = false;
+    while (i < length && (data[i] == ' ' || data[i] == '\t')) {
+        i++;
+    }
+    if (i == length) {
+        *unknown = !at_eof;
+        return false;
+    }
+    char c = data[i];
+    if (c == '\\' || c == '+') {
+        return true;
+    }
+    if (c == '-' || c == '.' || c == '&' || c == '|' || c == '?' || c == ':') {
+        if (i + 1 == length) {
+            *unknown = !at_eof;
+            return false;
+        }
+        char next = data[i + 1];
+        // ? and : of a ternary are followed by a blank; :echo starts a command
+        if (c == '?' || c == ':') {
+            return next == ' ' || next == '\t';
+        }
+        return (c == '-' && next == '>') || (c != '-' && next == c);
+    }
+    return false;
+}
+
+uint32_t tree_sitter_vim9_splitter_scan(TreeSitterVim9Splitter *splitter, const char *data,
+                                        uint32_t length, bool at_eof) {
+    uint32_t position = splitter->scanned;
+    for (;;) {
+        if (splitter->pending) {
+            bool unknown;
+            bool continued = continues(data, position, length, at_eof, &unknown);
+            if (unknown) {
+                break;
+            }
+            if (!continued) {
+                splitter->boundary = position;
+            }
+            splitter->pending = false;
+        }
+        const char *newline =
+            position < length ? memchr(data + position, '\n', length - position) : NULL;
+        if (!newline) {
+            break;
+        }
+        uint32_t end = (uint32_t)(newline - data);
+        scan_line(splitter, data + position, end - position);
+        position = end + 1;
+        splitter->scanned = position;
+        splitter->pending = !splitter->heredoc && splitter->blocks == 0 &&
+                            splitter->brackets == 0;
+    }
+    if (at_eof) {
+        // the caller takes the rest as the last piece; start over for the next input
+        tree_sitter_vim9_splitter_init(splitter);
+        splitter->scanned = splitter->boundary = length;
+        return length;
+    }
+    return splitter->boundary;
+}
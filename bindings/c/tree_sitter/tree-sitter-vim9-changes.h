@@ -0,0 +1,208 @@
+#ifndef TREE_SITTER_VIM9_CHANGES_H_
+#define TREE_SITTER_VIM9_CHANGES_H_
+
+// What to re-highlight after an incremental reparse, as whole lines: the
+// changed ranges of ts_tree_get_changed_ranges() plus the edited text itself
+// (which that function leaves out when only a token's text changed), each
+// widened to the statement_chain, def, if or for around it, then merged.
+// One call returns a packed array, so bindings cross their FFI once per
+// reparse instead of once per range and ancestor.
+//
+// Header-only: it calls into the tree-sitter runtime, which
+// libtree-sitter-vim9 doesn't link against.
+
+#include <tree_sitter/api.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rows are 0-based and both inclusive. start_byte is the start of start_row,
+// end_byte the end of the last statement in the span (not necessarily the
+// end of end_row). Four uint32_t, so the array can be handed out as is.
+typedef struct {
+    uint32_t start_row;
+    uint32_t end_row;
+    uint32_t start_byte;
+    uint32_t end_byte;
+} TreeSitterVim9LineSpan;
+
+// Reusable between calls, like TreeSitterVim9Outline.
+typedef struct {
+    uint32_t count;
+    uint32_t capacity;
+    TreeSitterVim9LineSpan *spans;
+} TreeSitterVim9LineSpans;
+
+static inline void tree_sitter_vim9_line_spans_free(TreeSitterVim9LineSpans *spans) {
+    free(spans->spans);
+    memset(spans, 0, sizeof(*spans));
+}
+
+static inline bool tree_sitter_vim9_line_spans_push(TreeSitterVim9LineSpans *spans,
+                                                    TreeSitterVim9LineSpan span) {
+    if (spans->count == spans->capacity) {
+        uint32_t capacity = spans->capacity ? spans->capacity * 2 : 16;
+        TreeSitterVim9LineSpan *grown = (TreeSitterVim9LineSpan *)realloc(
+            spans->spans, capacity * sizeof(TreeSitterVim9LineSpan));
+        if (!grown) {
+            return false;
+        }
+        spans->spans = grown;
+        spans->capacity = capacity;
+    }
+    spans->spans[spans->count++] = span;
+    return true;
+}
+
+// The statements a range is widened to.
+typedef struct {
+    TSSymbol statement_chain;
+    TSSymbol def_function;
+    TSSymbol if_statement;
+    TSSymbol for_statement;
+} TreeSitterVim9StatementSymbols;
+
+// The innermost statement around `byte` in the new tree, or the smallest node
+// there when it isn't inside one (a blank line, or an ERROR at the top).
+static inline TSNode tree_sitter_vim9_enclosing_statement(
+    const TreeSitterVim9StatementSymbols *symbols, TSNode root, uint32_t byte) {
+    TSNode node = ts_node_descendant_for_byte_range(root, byte, byte);
+    for (TSNode ancestor = node; !ts_node_is_null(ancestor);
+         ancestor = ts_node_parent(ancestor)) {
+        TSSymbol symbol = ts_node_symbol(ancestor);
+        if (symbol == symbols->statement_chain || symbol == symbols->def_function ||
+            symbol == symbols->if_statement || symbol == symbols->for_statement) {
+            return ancestor;
+        }
+    }
+    return node;
+}
+
+static inline bool tree_sitter_vim9_push_snapped(const TreeSitterVim9StatementSymbols *symbols,
+                                                 TSNode root, uint32_t start_byte,
+                                                 uint32_t end_byte,
+                                                 TreeSitterVim9LineSpans *spans) {
+    TSNode first = tree_sitter_vim9_enclosing_statement(symbols, root, start_byte);
+    TSNode last = end_byte > start_byte
+                      ? tree_sitter_vim9_enclosing_statement(symbols, root, end_byte - 1)
+                      : first;
+    TSPoint start = ts_node_start_point(first);
+    TSPoint end = ts_node_end_point(last);
+    uint32_t last_end = ts_node_end_byte(last);
+    TreeSitterVim9LineSpan span = {
+        start.row,
+        end.row,
+        ts_node_start_byte(first) - start.column,
+        last_end > end_byte ? last_end : end_byte,
+    };
+    return tree_sitter_vim9_line_spans_push(spans, span);
+}
+
+static inline int tree_sitter_vim9_compare_spans(const void *a, const void *b) {
+    const TreeSitterVim9LineSpan *left = (const TreeSitterVim9LineSpan *)a;
+    const TreeSitterVim9LineSpan *right = (const TreeSitterVim9LineSpan *)b;
+    return left->start_row < right->start_row ? -1 : left->start_row > right->start_row;
+}
+
+// `old_tree` is the tree that was ts_tree_edit()ed and passed to the parse
+// that produced `new_tree`. Replaces the contents of `spans` with spans in
+// document order, none of them overlapping or on adjacent lines. Returns the
+// number of spans, or UINT32_MAX when memory runs out.
+static inline uint32_t tree_sitter_vim9_changed_lines(const TSTree *old_tree,
+                                                      const TSTree *new_tree,
+                                                      TreeSitterVim9LineSpans *spans) {
+    const TSLanguage *language = ts_tree_language(new_tree);
+    TreeSitterVim9StatementSymbols symbols = {
+        ts_language_symbol_for_name(language, "statement_chain", 15, true),
+        ts_language_symbol_for_name(language, "def_function", 12, true),
+        ts_language_symbol_for_name(language, "if_statement", 12, true),
+        ts_language_symbol_for_name(language, "for_statement", 13, true),
+    };
+    TSNode root = ts_tree_root_node(new_tree);
+    spans->count = 0;
+    bool ok = true;
+
+    uint32_t range_count;
+    TSRange *ranges = ts_tree_get_changed_ranges(old_tree, new_tree, &range_count);
+    for (uint32_t i = 0; ok && i < range_count; i++) {
+        ok = tree_sitter_vim9_push_snapped(&symbols, root, ranges[i].start_byte,
+                                           ranges[i].end_byte, spans);
+    }
+    free(ranges);
+
+    // The edits: the innermost nodes of the edited old tree marked as changed,
+    // whose positions ts_tree_edit() already moved to new-tree coordinates.
+    // Only the paths down to the edits are walked.
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(old_tree));
+    bool walking = ok && ts_node_has_changes(ts_tree_cursor_current_node(&cursor));
+    while (walking) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        bool changed_child = false;
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            do {
+                changed_child = ts_node_has_changes(ts_tree_cursor_current_node(&cursor));
+            } while (!changed_child && ts_tree_cursor_goto_next_sibling(&cursor));
+            if (changed_child) {
+                continue;
+            }
+            ts_tree_cursor_goto_parent(&cursor);
+        }
+        if (!tree_sitter_vim9_push_snapped(&symbols, root, ts_node_start_byte(node),
+                                           ts_node_end_byte(node), spans)) {
+            ok = false;
+            break;
+        }
+        // on to the next changed node after this one
+        for (;;) {
+            bool found = false;
+            while (!found && ts_tree_cursor_goto_next_sibling(&cursor)) {
+                found = ts_node_has_changes(ts_tree_cursor_current_node(&cursor));
+            }
+            if (found) {
+                break;
+            }
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                walking = false;
+                break;
+            }
+        }
+    }
+    ts_tree_cursor_delete(&cursor);
+    if (!ok) {
+        return UINT32_MAX;
+    }
+
+    if (spans->count > 1) {
+        qsort(spans->spans, spans->count, sizeof(TreeSitterVim9LineSpan),
+              tree_sitter_vim9_compare_spans);
+    }
+    uint32_t merged = 0;
+    for (uint32_t i = 0; i < spans->count; i++) {
+        TreeSitterVim9LineSpan span = spans->spans[i];
+        TreeSitterVim9LineSpan *previous = merged ? &spans->spans[merged - 1] : NULL;
+        if (previous && span.start_row <= previous->end_row + 1) {
+            if (span.end_row > previous->end_row) {
+                previous->end_row = span.end_row;
+            }
+            if (span.end_byte > previous->end_byte) {
+                previous->end_byte = span.end_byte;
+            }
+        } else {
+            spans->spans[merged++] = span;
+        }
+    }
+    spans->count = merged;
+    return merged;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VIM9_CHANGES_H_
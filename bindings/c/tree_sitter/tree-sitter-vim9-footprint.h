@@ -0,0 +1,175 @@
+#ifndef TREE_SITTER_VIM9_FOOTPRINT_H_
+#define TREE_SITTER_VIM9_FOOTPRINT_H_
+
+// What parsed trees cost in memory, per symbol of ts_symbol_names: node
+// count, estimated bytes and the deepest level each symbol appears at.
+// Meant for comparing grammar changes (hiding a rule, merging tokens), not
+// for exact accounting.
+//
+// The estimate follows the runtime's layout on 64-bit targets: every node
+// takes an 8-byte slot in its parent's child array, and every node that
+// isn't an inline leaf also has a heap record (SubtreeHeapData, 80 bytes).
+// Leaves are inline when the symbol fits in a byte and the token and the
+// whitespace before it are short and on one line; external tokens never are,
+// which the public API can't tell apart, so leaves from the scanner are
+// under-counted. Hidden nodes (_expression, repeat helpers) aren't reachable
+// through the public API either and don't show up at all.
+//
+// Header-only: it calls into the tree-sitter runtime, which
+// libtree-sitter-vim9 doesn't link against.
+
+#include <tree_sitter/api.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TREE_SITTER_VIM9_SUBTREE_SLOT_BYTES 8
+#define TREE_SITTER_VIM9_SUBTREE_HEAP_BYTES 80
+
+typedef struct {
+    uint64_t nodes;
+    uint64_t bytes;
+    uint32_t max_depth;  // the root is at depth 1
+} TreeSitterVim9SymbolFootprint;
+
+// Accumulates over any number of trees; zero-initialize before the first
+// tree_sitter_vim9_footprint_add(). symbols[i] is symbol i of the language
+// for i < symbol_count - 1, and symbols[symbol_count - 1] counts ERROR nodes.
+typedef struct {
+    uint32_t symbol_count;
+    uint32_t max_depth;
+    uint64_t trees;
+    uint64_t nodes;
+    uint64_t bytes;
+    TreeSitterVim9SymbolFootprint *symbols;
+} TreeSitterVim9Footprint;
+
+static inline void tree_sitter_vim9_footprint_free(TreeSitterVim9Footprint *footprint) {
+    free(footprint->symbols);
+    memset(footprint, 0, sizeof(*footprint));
+}
+
+static inline bool tree_sitter_vim9_footprint_reserve(TreeSitterVim9Footprint *footprint,
+                                                      uint32_t symbol_count) {
+    if (footprint->symbols) {
+        return true;
+    }
+    footprint->symbols = (TreeSitterVim9SymbolFootprint *)calloc(
+        symbol_count, sizeof(TreeSitterVim9SymbolFootprint));
+    footprint->symbol_count = footprint->symbols ? symbol_count : 0;
+    return footprint->symbols != NULL;
+}
+
+// The name of entry `index` of `footprint->symbols`.
+static inline const char *tree_sitter_vim9_footprint_symbol_name(
+    const TreeSitterVim9Footprint *footprint, const TSLanguage *language, uint32_t index) {
+    return index + 1 == footprint->symbol_count ? "ERROR"
+                                                : ts_language_symbol_name(language, (TSSymbol)index);
+}
+
+// The same length limits ts_subtree_new_leaf() checks before storing a leaf inline.
+static inline bool tree_sitter_vim9_footprint_inline(TSSymbol symbol, TSPoint previous_end,
+                                                     uint32_t previous_end_byte, TSNode node) {
+    TSPoint start = ts_node_start_point(node), end = ts_node_end_point(node);
+    uint32_t start_byte = ts_node_start_byte(node);
+    uint32_t padding_rows = start.row - previous_end.row;
+    uint32_t padding_columns = padding_rows ? start.column : start.column - previous_end.column;
+    return symbol <= UINT8_MAX && start_byte - previous_end_byte < 255 && padding_rows < 16 &&
+           padding_columns < 255 && end.row == start.row && end.column - start.column < 255;
+}
+
+// Adds `tree` to `footprint`. Returns false when memory runs out.
+static inline bool tree_sitter_vim9_footprint_add(TreeSitterVim9Footprint *footprint,
+                                                  const TSTree *tree) {
+    const TSLanguage *language = ts_tree_language(tree);
+    if (!tree_sitter_vim9_footprint_reserve(footprint, ts_language_symbol_count(language) + 1)) {
+        return false;
+    }
+    footprint->trees++;
+
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    uint32_t depth = 1;
+    TSPoint previous_end = {0, 0};
+    uint32_t previous_end_byte = 0;
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        TSSymbol symbol = ts_node_symbol(node);
+        uint32_t index = ts_node_is_error(node) || symbol + 1u >= footprint->symbol_count
+                             ? footprint->symbol_count - 1
+                             : symbol;
+        bool leaf = ts_node_child_count(node) == 0;
+        uint64_t bytes = TREE_SITTER_VIM9_SUBTREE_SLOT_BYTES;
+        if (!leaf || !tree_sitter_vim9_footprint_inline(symbol, previous_end, previous_end_byte,
+                                                        node)) {
+            bytes += TREE_SITTER_VIM9_SUBTREE_HEAP_BYTES;
+        }
+        if (leaf) {
+            previous_end = ts_node_end_point(node);
+            previous_end_byte = ts_node_end_byte(node);
+        }
+
+        TreeSitterVim9SymbolFootprint *entry = &footprint->symbols[index];
+        entry->nodes++;
+        entry->bytes += bytes;
+        if (depth > entry->max_depth) {
+            entry->max_depth = depth;
+        }
+        footprint->nodes++;
+        footprint->bytes += bytes;
+        if (depth > footprint->max_depth) {
+            footprint->max_depth = depth;
+        }
+
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            depth++;
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return true;
+            }
+            depth--;
+        }
+    }
+}
+
+// Adds the counts of `from` to `into`, e.g. per-thread footprints at the end
+// of a parallel run. Returns false when memory runs out.
+static inline bool tree_sitter_vim9_footprint_merge(TreeSitterVim9Footprint *into,
+                                                    const TreeSitterVim9Footprint *from) {
+    if (!from->symbols) {
+        return true;
+    }
+    if (!tree_sitter_vim9_footprint_reserve(into, from->symbol_count)) {
+        return false;
+    }
+    uint32_t count = into->symbol_count < from->symbol_count ? into->symbol_count
+                                                             : from->symbol_count;
+    for (uint32_t i = 0; i < count; i++) {
+        into->symbols[i].nodes += from->symbols[i].nodes;
+        into->symbols[i].bytes += from->symbols[i].bytes;
+        if (from->symbols[i].max_depth > into->symbols[i].max_depth) {
+            into->symbols[i].max_depth = from->symbols[i].max_depth;
+        }
+    }
+    into->trees += from->trees;
+    into->nodes += from->nodes;
+    into->bytes += from->bytes;
+    if (from->max_depth > into->max_depth) {
+        into->max_depth = from->max_depth;
+    }
+    return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VIM9_FOOTPRINT_H_
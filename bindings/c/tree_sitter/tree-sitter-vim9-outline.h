@@ -0,0 +1,143 @@
+#ifndef TREE_SITTER_VIM9_OUTLINE_H_
+#define TREE_SITTER_VIM9_OUTLINE_H_
+
+// The declarations of a file (def, var, const) collected in one cursor pass
+// into flat arrays, so bindings can hand the whole outline over at once
+// instead of walking the tree node by node across their FFI.
+//
+// Header-only: it calls into the tree-sitter runtime, which
+// libtree-sitter-vim9 doesn't link against. TreeSitterVim9Outline itself is
+// declared in tree-sitter-vim9.h.
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The node kinds the walk needs, looked up once per call (a few hundred
+// integer compares; negligible next to the parse itself).
+typedef struct {
+    TSSymbol def_function;
+    TSSymbol let_statement;
+    TSSymbol const_statement;
+    TSFieldId name;
+    // Declarations only appear directly under these, so everything else
+    // (expressions, arguments, commands) is skipped without descending.
+    TSSymbol containers[6];
+} TreeSitterVim9OutlineSymbols;
+
+static inline TSSymbol tree_sitter_vim9_outline_symbol(const TSLanguage *language,
+                                                       const char *name) {
+    return ts_language_symbol_for_name(language, name, (uint32_t)strlen(name), true);
+}
+
+static inline bool tree_sitter_vim9_outline_descends(const TreeSitterVim9OutlineSymbols *symbols,
+                                                     TSNode node) {
+    TSSymbol symbol = ts_node_symbol(node);
+    if (symbol == symbols->def_function || ts_node_is_error(node)) {
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(symbols->containers) / sizeof(TSSymbol); i++) {
+        if (symbol == symbols->containers[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Replaces the contents of `outline` (which may be zero-initialized or reused
+// from an earlier call). Returns the number of entries, or UINT32_MAX when
+// memory runs out.
+static inline uint32_t tree_sitter_vim9_outline(const TSTree *tree,
+                                                TreeSitterVim9Outline *outline) {
+    const TSLanguage *language = ts_tree_language(tree);
+    TreeSitterVim9OutlineSymbols symbols = {
+        tree_sitter_vim9_outline_symbol(language, "def_function"),
+        tree_sitter_vim9_outline_symbol(language, "let_statement"),
+        tree_sitter_vim9_outline_symbol(language, "const_statement"),
+        ts_language_field_id_for_name(language, "name", 4),
+        {
+            tree_sitter_vim9_outline_symbol(language, "source_file"),
+            tree_sitter_vim9_outline_symbol(language, "statement_chain"),
+            tree_sitter_vim9_outline_symbol(language, "if_statement"),
+            tree_sitter_vim9_outline_symbol(language, "elseif_clause"),
+            tree_sitter_vim9_outline_symbol(language, "else_clause"),
+            tree_sitter_vim9_outline_symbol(language, "for_statement"),
+        },
+    };
+    outline->count = 0;
+
+    // Open defs as (depth, entry index), innermost last.
+    uint32_t def_depth[64];
+    int32_t def_index[64];
+    unsigned open_defs = 0;
+    uint32_t depth = 0;
+
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        TSSymbol symbol = ts_node_symbol(node);
+        uint8_t kind = symbol == symbols.def_function      ? TREE_SITTER_VIM9_OUTLINE_DEF
+                       : symbol == symbols.let_statement   ? TREE_SITTER_VIM9_OUTLINE_VAR
+                       : symbol == symbols.const_statement ? TREE_SITTER_VIM9_OUTLINE_CONST
+                                                           : 0;
+        TSNode name = kind ? ts_node_child_by_field_id(node, symbols.name) : node;
+        if (kind && !ts_node_is_null(name) && !ts_node_is_missing(name)) {
+            uint32_t capacity = outline->capacity ? outline->capacity * 2 : 64;
+            if (outline->count == outline->capacity &&
+                !tree_sitter_vim9_outline_reserve(outline, capacity)) {
+                ts_tree_cursor_delete(&cursor);
+                return UINT32_MAX;
+            }
+            uint32_t i = outline->count++;
+            // `export` is the first, anonymous child of an exported def
+            TSNode first = ts_node_child(node, 0);
+            bool exported = kind == TREE_SITTER_VIM9_OUTLINE_DEF && !ts_node_is_named(first) &&
+                            strcmp(ts_node_type(first), "export") == 0;
+            TSPoint start = ts_node_start_point(node), end = ts_node_end_point(node);
+            outline->kind[i] = kind;
+            outline->flags[i] = exported ? TREE_SITTER_VIM9_OUTLINE_EXPORTED : 0;
+            outline->parent[i] = open_defs ? def_index[open_defs - 1] : -1;
+            outline->name_start[i] = ts_node_start_byte(name);
+            outline->name_end[i] = ts_node_end_byte(name);
+            outline->start_row[i] = start.row;
+            outline->start_column[i] = start.column;
+            outline->end_row[i] = end.row;
+            outline->end_column[i] = end.column;
+            if (kind == TREE_SITTER_VIM9_OUTLINE_DEF &&
+                open_defs < sizeof(def_index) / sizeof(def_index[0])) {
+                def_depth[open_defs] = depth;
+                def_index[open_defs++] = (int32_t)i;
+            }
+        }
+
+        if (tree_sitter_vim9_outline_descends(&symbols, node) &&
+            ts_tree_cursor_goto_first_child(&cursor)) {
+            depth++;
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return outline->count;
+            }
+            depth--;
+        }
+        // Siblings at or above a def's depth are outside it.
+        while (open_defs && def_depth[open_defs - 1] >= depth) {
+            open_defs--;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VIM9_OUTLINE_H_
@@ -0,0 +1,281 @@
+#ifndef TREE_SITTER_VIM9_STREAM_H_
+#define TREE_SITTER_VIM9_STREAM_H_
+
+// Parses a file too large to hold (or to parse) in one piece: reads it in
+// blocks, cuts it with tree_sitter_vim9_splitter_scan() at top-level
+// boundaries, parses each piece as a tree of its own and hands it to a
+// callback, then deletes the tree and drops the piece. Memory stays at about
+// `chunk_bytes` of text (plus the longest top-level construct) and one tree
+// per thread, whatever the file size.
+//
+// A piece is a whole number of top-level statements, so its tree is what the
+// full parse would have for those lines, with rows and bytes counted from the
+// start of the piece; chunk->start_row and chunk->start_byte put them back in
+// file coordinates. Generated files (syntax tables, dictionaries, long lists
+// of commands) have boundaries every few lines; a file that is one big def
+// is one piece.
+//
+// With `threads` > 1 the pieces are parsed on that many threads and the
+// callback runs on those threads too, one call at a time but not in file
+// order (chunk->index tells the order). Each thread holds one piece at a
+// time. Windows builds parse on the calling thread.
+//
+// Header-only: it calls into the tree-sitter runtime, which
+// libtree-sitter-vim9 doesn't link against. The threaded path needs
+// -pthread.
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TREE_SITTER_VIM9_STREAM_CHUNK_BYTES (1u << 20)
+
+typedef struct {
+    const char *data;  // the text of the piece, valid during the callback only
+    uint32_t length;
+    uint64_t start_byte;  // where the piece starts in the file
+    uint64_t start_row;
+    uint64_t index;  // 0 for the first piece of the file, and so on
+} TreeSitterVim9Chunk;
+
+// Return false to stop: tree_sitter_vim9_parse_stream() then returns ECANCELED.
+// The tree is deleted after the call returns.
+typedef bool (*TreeSitterVim9ChunkCallback)(void *payload, const TSTree *tree,
+                                            const TreeSitterVim9Chunk *chunk);
+
+typedef struct {
+    uint32_t chunk_bytes;  // a piece is cut once it has this much text; 0 means 1 MiB
+    uint32_t threads;      // 0 and 1 parse on the calling thread
+} TreeSitterVim9StreamOptions;
+
+// Reading: the text not yet handed out as pieces, and the splitter state over it.
+typedef struct {
+    FILE *file;
+    char *data;
+    uint32_t length;
+    uint32_t capacity;
+    uint32_t chunk_bytes;
+    bool eof;
+    uint64_t start_byte;
+    uint64_t start_row;
+    uint64_t index;
+    TreeSitterVim9Splitter splitter;
+} TreeSitterVim9StreamReader;
+
+static inline uint64_t tree_sitter_vim9_stream_rows(const char *data, uint32_t length) {
+    uint64_t rows = 0;
+    for (const char *p = data, *end = data + length;
+         (p = (const char *)memchr(p, '\n', (size_t)(end - p))); p++) {
+        rows++;
+    }
+    return rows;
+}
+
+// Takes the next piece out of the reader into a buffer of its own. Returns 0
+// and chunk->data == NULL at the end of the file, or an errno.
+static inline int tree_sitter_vim9_stream_next(TreeSitterVim9StreamReader *reader,
+                                              TreeSitterVim9Chunk *chunk) {
+    chunk->data = NULL;
+    uint32_t cut = 0;
+    for (;;) {
+        if (reader->length >= reader->chunk_bytes || reader->eof) {
+            cut = tree_sitter_vim9_splitter_scan(&reader->splitter, reader->data,
+                                                 reader->length, reader->eof);
+            if (cut > 0 || reader->eof) {
+                break;
+            }
+        }
+        // no boundary yet: read up to chunk_bytes, or another block when a
+        // construct is longer than that, growing the buffer if it doesn't fit
+        uint32_t want = reader->length < reader->chunk_bytes
+                            ? reader->chunk_bytes - reader->length
+                            : reader->chunk_bytes;
+        if (reader->length + (uint64_t)want > reader->capacity) {
+            uint64_t capacity = reader->capacity ? reader->capacity : reader->chunk_bytes;
+            while (capacity < reader->length + (uint64_t)want) {
+                capacity *= 2;
+            }
+            if (capacity > UINT32_MAX) {
+                return ENOMEM;
+            }
+            char *data = (char *)realloc(reader->data, (size_t)capacity);
+            if (!data) {
+                return ENOMEM;
+            }
+            reader->data = data;
+            reader->capacity = (uint32_t)capacity;
+        }
+        size_t n = fread(reader->data + reader->length, 1, want, reader->file);
+        reader->length += (uint32_t)n;
+        if (n == 0) {
+            if (ferror(reader->file)) {
+                return EIO;
+            }
+            reader->eof = true;
+        }
+    }
+    if (cut == 0) {
+        return 0;
+    }
+
+    char *piece = (char *)malloc(cut);
+    if (!piece) {
+        return ENOMEM;
+    }
+    memcpy(piece, reader->data, cut);
+    memmove(reader->data, reader->data + cut, reader->length - cut);
+    reader->length -= cut;
+    tree_sitter_vim9_splitter_consume(&reader->splitter, cut);
+
+    *chunk = (TreeSitterVim9Chunk){piece, cut, reader->start_byte, reader->start_row,
+                                   reader->index++};
+    reader->start_byte += cut;
+    reader->start_row += tree_sitter_vim9_stream_rows(piece, cut);
+    return 0;
+}
+
+static inline int tree_sitter_vim9_stream_parse(TSParser *parser, const TreeSitterVim9Chunk *chunk,
+                                               TreeSitterVim9ChunkCallback callback,
+                                               void *payload) {
+    TSTree *tree = ts_parser_parse_string(parser, NULL, chunk->data, chunk->length);
+    if (!tree) {
+        return ECANCELED;
+    }
+    bool go_on = callback(payload, tree, chunk);
+    ts_tree_delete(tree);
+    return go_on ? 0 : ECANCELED;
+}
+
+#ifndef _WIN32
+
+// Threads take pieces from the reader under a lock: the reader is the queue,
+// and a piece exists only while a thread is parsing it, so at most `threads`
+// pieces are held besides the one being read.
+typedef struct {
+    pthread_mutex_t lock;
+    TreeSitterVim9StreamReader *reader;
+    TreeSitterVim9ChunkCallback callback;
+    void *payload;
+    int status;
+} TreeSitterVim9StreamShared;
+
+static inline void *tree_sitter_vim9_stream_worker(void *argument) {
+    TreeSitterVim9StreamShared *shared = (TreeSitterVim9StreamShared *)argument;
+    TSParser *parser = ts_parser_new();
+    int status = ts_parser_set_language(parser, tree_sitter_vim9()) ? 0 : EINVAL;
+    for (;;) {
+        TreeSitterVim9Chunk chunk = {0};
+        pthread_mutex_lock(&shared->lock);
+        if (status && !shared->status) {
+            shared->status = status;
+        }
+        if (!shared->status) {
+            shared->status = tree_sitter_vim9_stream_next(shared->reader, &chunk);
+        }
+        pthread_mutex_unlock(&shared->lock);
+        if (!chunk.data) {
+            break;
+        }
+        // pieces parse in parallel; their callbacks run one at a time
+        TSTree *tree = ts_parser_parse_string(parser, NULL, chunk.data, chunk.length);
+        pthread_mutex_lock(&shared->lock);
+        if (!tree) {
+            status = ECANCELED;
+        } else if (!shared->status && !shared->callback(shared->payload, tree, &chunk)) {
+            status = ECANCELED;
+        }
+        pthread_mutex_unlock(&shared->lock);
+        ts_tree_delete(tree);
+        free((void *)chunk.data);
+    }
+    ts_parser_delete(parser);
+    return NULL;
+}
+
+#endif
+
+// Parses all of `file` piece by piece. Returns 0, or ECANCELED when the
+// callback stopped it, EIO on a read error, ENOMEM, or EINVAL when the runtime
+// can't load the language.
+static inline int tree_sitter_vim9_parse_stream(FILE *file,
+                                               const TreeSitterVim9StreamOptions *options,
+                                               TreeSitterVim9ChunkCallback callback,
+                                               void *payload) {
+    TreeSitterVim9StreamReader reader = {0};
+    reader.file = file;
+    reader.chunk_bytes = options && options->chunk_bytes ? options->chunk_bytes
+                                                         : TREE_SITTER_VIM9_STREAM_CHUNK_BYTES;
+    tree_sitter_vim9_splitter_init(&reader.splitter);
+    int status = 0;
+
+#ifndef _WIN32
+    uint32_t threads = options && options->threads ? options->threads : 1;
+    if (threads > 1) {
+        TreeSitterVim9StreamShared shared = {PTHREAD_MUTEX_INITIALIZER, &reader, callback,
+                                             payload, 0};
+        pthread_t *workers = (pthread_t *)calloc(threads, sizeof(pthread_t));
+        if (!workers) {
+            return ENOMEM;
+        }
+        uint32_t started = 0;
+        while (started < threads &&
+               pthread_create(&workers[started], NULL, tree_sitter_vim9_stream_worker,
+                              &shared) == 0) {
+            started++;
+        }
+        if (started == 0) {
+            // no thread at all: fall through to the calling thread
+            free(workers);
+        } else {
+            for (uint32_t i = 0; i < started; i++) {
+                pthread_join(workers[i], NULL);
+            }
+            free(workers);
+            pthread_mutex_destroy(&shared.lock);
+            free(reader.data);
+            return shared.status;
+        }
+    }
+#endif
+
+    TSParser *parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_vim9())) {
+        ts_parser_delete(parser);
+        return EINVAL;
+    }
+    for (;;) {
+        TreeSitterVim9Chunk chunk;
+        status = tree_sitter_vim9_stream_next(&reader, &chunk);
+        if (status || !chunk.data) {
+            break;
+        }
+        status = tree_sitter_vim9_stream_parse(parser, &chunk, callback, payload);
+        free((void *)chunk.data);
+        if (status) {
+            break;
+        }
+    }
+    ts_parser_delete(parser);
+    free(reader.data);
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VIM9_STREAM_H_
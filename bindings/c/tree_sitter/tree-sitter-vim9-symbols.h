@@ -0,0 +1,213 @@
+// Generated by tools/symbols/gen.c from src/parser.c; do not edit.
+// Regenerate with `make symbols` (or the CMake `symbols` target) whenever
+// src/parser.c is regenerated.
+//
+// The public symbol ids ts_node_symbol() returns, and the field ids, of the
+// parser this header was generated from, so a consumer can dispatch with a
+// switch instead of comparing ts_node_type() strings. The ids are only
+// stable for one generated parser: check TREE_SITTER_VIM9_SYMBOL_COUNT and
+// TREE_SITTER_VIM9_FIELD_COUNT against ts_language_symbol_count() and
+// ts_language_field_count() when loading the language dynamically.
+
+#ifndef TREE_SITTER_VIM9_SYMBOLS_H_
+#define TREE_SITTER_VIM9_SYMBOLS_H_
+
+#include <stdbool.h>
+
+#define TREE_SITTER_VIM9_LANGUAGE_VERSION 15
+#define TREE_SITTER_VIM9_SYMBOL_COUNT 104
+#define TREE_SITTER_VIM9_FIELD_COUNT 0
+
+enum {
+    TREE_SITTER_VIM9_SYM_ERROR = 65535,  // "ERROR"
+    TREE_SITTER_VIM9_ANON_PIPE = 1,  // "|"
+    TREE_SITTER_VIM9_SYM_NEWLINE = 2,  // "newline"
+    TREE_SITTER_VIM9_SYM_VIM9SCRIPT = 3,  // "vim9script"
+    TREE_SITTER_VIM9_ANON_POUND = 4,  // "#"
+    TREE_SITTER_VIM9_SYM_SPECIAL_KEY = 6,  // "special_key"
+    TREE_SITTER_VIM9_SYM_RAW_TEXT = 7,  // "raw_text"
+    TREE_SITTER_VIM9_SYM_COMMAND_NAME = 8,  // "command_name"
+    TREE_SITTER_VIM9_ANON_CONST = 9,  // "const"
+    TREE_SITTER_VIM9_ANON_COLON = 10,  // ":"
+    TREE_SITTER_VIM9_ANON_EQ = 11,  // "="
+    TREE_SITTER_VIM9_ANON_VAR = 12,  // "var"
+    TREE_SITTER_VIM9_ANON_DOT_DOT_EQ = 13,  // "..="
+    TREE_SITTER_VIM9_ANON_PLUS_EQ = 14,  // "+="
+    TREE_SITTER_VIM9_ANON_DASH_EQ = 15,  // "-="
+    TREE_SITTER_VIM9_ANON_STAR_EQ = 16,  // "*="
+    TREE_SITTER_VIM9_ANON_SLASH_EQ = 17,  // "/="
+    TREE_SITTER_VIM9_SYM_SCOPE_VAR = 18,  // "scope_var"
+    TREE_SITTER_VIM9_SYM_OPTION_VAR = 19,  // "option_var"
+    TREE_SITTER_VIM9_ANON_LBRACK = 20,  // "["
+    TREE_SITTER_VIM9_ANON_RBRACK = 21,  // "]"
+    TREE_SITTER_VIM9_ANON_LPAREN = 23,  // "("
+    TREE_SITTER_VIM9_ANON_RPAREN = 24,  // ")"
+    TREE_SITTER_VIM9_ANON_COMMA = 25,  // ","
+    TREE_SITTER_VIM9_ANON_EQ_GT = 27,  // "=>"
+    TREE_SITTER_VIM9_ANON_LBRACE = 28,  // "{"
+    TREE_SITTER_VIM9_ANON_RBRACE = 29,  // "}"
+    TREE_SITTER_VIM9_ANON_BOOL = 30,  // "bool"
+    TREE_SITTER_VIM9_ANON_NUMBER = 31,  // "number"
+    TREE_SITTER_VIM9_ANON_FLOAT = 32,  // "float"
+    TREE_SITTER_VIM9_ANON_STRING = 33,  // "string"
+    TREE_SITTER_VIM9_ANON_ANY = 34,  // "any"
+    TREE_SITTER_VIM9_ANON_LIST = 35,  // "list"
+    TREE_SITTER_VIM9_ANON_LT = 36,  // "<"
+    TREE_SITTER_VIM9_ANON_GT = 37,  // ">"
+    TREE_SITTER_VIM9_ANON_DICT = 38,  // "dict"
+    TREE_SITTER_VIM9_SYM_NUMBER = 39,  // "number"
+    TREE_SITTER_VIM9_SYM_FLOAT = 40,  // "float"
+    TREE_SITTER_VIM9_SYM_BOOLEAN = 41,  // "boolean"
+    TREE_SITTER_VIM9_SYM_STRING = 42,  // "string"
+    TREE_SITTER_VIM9_ANON_BANG = 43,  // "!"
+    TREE_SITTER_VIM9_ANON_DASH = 44,  // "-"
+    TREE_SITTER_VIM9_ANON_DASH_GT = 45,  // "->"
+    TREE_SITTER_VIM9_ANON_DOT_DOT = 46,  // ".."
+    TREE_SITTER_VIM9_ANON_PLUS = 47,  // "+"
+    TREE_SITTER_VIM9_ANON_STAR = 48,  // "*"
+    TREE_SITTER_VIM9_ANON_SLASH = 49,  // "/"
+    TREE_SITTER_VIM9_ANON_EQ_EQ = 50,  // "=="
+    TREE_SITTER_VIM9_ANON_BANG_EQ = 51,  // "!="
+    TREE_SITTER_VIM9_ANON_EQ_EQ_POUND = 52,  // "==#"
+    TREE_SITTER_VIM9_ANON_BANG_EQ_POUND = 53,  // "!=#"
+    TREE_SITTER_VIM9_ANON_EQ_EQ_QMARK = 54,  // "==?"
+    TREE_SITTER_VIM9_ANON_BANG_EQ_QMARK = 55,  // "!=?"
+    TREE_SITTER_VIM9_ANON_EQ_TILDE = 56,  // "=~"
+    TREE_SITTER_VIM9_ANON_BANG_TILDE = 57,  // "!~"
+    TREE_SITTER_VIM9_ANON_EQ_TILDE_POUND = 58,  // "=~#"
+    TREE_SITTER_VIM9_ANON_BANG_TILDE_POUND = 59,  // "!~#"
+    TREE_SITTER_VIM9_ANON_GT_EQ = 60,  // ">="
+    TREE_SITTER_VIM9_ANON_LT_EQ = 61,  // "<="
+    TREE_SITTER_VIM9_ANON_AMP_AMP = 62,  // "&&"
+    TREE_SITTER_VIM9_ANON_PIPE_PIPE = 63,  // "||"
+    TREE_SITTER_VIM9_ANON_QMARK = 64,  // "?"
+    TREE_SITTER_VIM9_SYM_CHAINABLE_STATEMENT = 65,  // "chainable_statement"
+    TREE_SITTER_VIM9_SYM_STATEMENT_CHAIN = 66,  // "statement_chain"
+    TREE_SITTER_VIM9_SYM_COMMENT = 67,  // "comment"
+    TREE_SITTER_VIM9_SYM_COMMAND = 68,  // "command"
+    TREE_SITTER_VIM9_SYM_SAFE_ARG = 69,  // "safe_arg"
+    TREE_SITTER_VIM9_SYM_CONST_STATEMENT = 70,  // "const_statement"
+    TREE_SITTER_VIM9_SYM_LET_STATEMENT = 71,  // "let_statement"
+    TREE_SITTER_VIM9_SYM_ASSIGNMENT = 72,  // "assignment"
+    TREE_SITTER_VIM9_SYM_AUGMENTED_ASSIGNMENT = 73,  // "augmented_assignment"
+    TREE_SITTER_VIM9_SYM_LVALUE = 74,  // "lvalue"
+    TREE_SITTER_VIM9_SYM_INDEX_EXPRESSION = 75,  // "index_expression"
+    TREE_SITTER_VIM9_SYM_EXPR_STATEMENT = 76,  // "expr_statement"
+    TREE_SITTER_VIM9_SYM_IDENTIFIER = 77,  // "identifier"
+    TREE_SITTER_VIM9_SYM_FUNCTION_NAME = 78,  // "function_name"
+    TREE_SITTER_VIM9_SYM_CALL_EXPRESSION = 79,  // "call_expression"
+    TREE_SITTER_VIM9_SYM_ARGUMENTS = 80,  // "arguments"
+    TREE_SITTER_VIM9_SYM_ARROW_FUNCTION = 81,  // "arrow_function"
+    TREE_SITTER_VIM9_SYM_BLOCK = 82,  // "block"
+    TREE_SITTER_VIM9_SYM_PARAMETER = 83,  // "parameter"
+    TREE_SITTER_VIM9_SYM_TYPE = 84,  // "type"
+    TREE_SITTER_VIM9_SYM_EXPR = 85,  // "expr"
+    TREE_SITTER_VIM9_SYM_PARENTHESIZED_EXPRESSION = 86,  // "parenthesized_expression"
+    TREE_SITTER_VIM9_SYM_LIST = 87,  // "list"
+    TREE_SITTER_VIM9_SYM_PAIR = 88,  // "pair"
+    TREE_SITTER_VIM9_SYM_DICT_KEY = 89,  // "dict_key"
+    TREE_SITTER_VIM9_SYM_DICT = 90,  // "dict"
+    TREE_SITTER_VIM9_SYM_UNARY_EXPRESSION = 91,  // "unary_expression"
+    TREE_SITTER_VIM9_SYM_METHOD_CALL = 92,  // "method_call"
+    TREE_SITTER_VIM9_SYM_BINARY_EXPRESSION = 93,  // "binary_expression"
+    TREE_SITTER_VIM9_SYM_TERNARY_EXPRESSION = 94,  // "ternary_expression"
+};
+
+// X(constant, id, type, named) for every constant above except ERROR.
+#define TREE_SITTER_VIM9_SYMBOL_LIST(X) \
+    X(TREE_SITTER_VIM9_ANON_PIPE, 1, "|", false) \
+    X(TREE_SITTER_VIM9_SYM_NEWLINE, 2, "newline", true) \
+    X(TREE_SITTER_VIM9_SYM_VIM9SCRIPT, 3, "vim9script", true) \
+    X(TREE_SITTER_VIM9_ANON_POUND, 4, "#", false) \
+    X(TREE_SITTER_VIM9_SYM_SPECIAL_KEY, 6, "special_key", true) \
+    X(TREE_SITTER_VIM9_SYM_RAW_TEXT, 7, "raw_text", true) \
+    X(TREE_SITTER_VIM9_SYM_COMMAND_NAME, 8, "command_name", true) \
+    X(TREE_SITTER_VIM9_ANON_CONST, 9, "const", false) \
+    X(TREE_SITTER_VIM9_ANON_COLON, 10, ":", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ, 11, "=", false) \
+    X(TREE_SITTER_VIM9_ANON_VAR, 12, "var", false) \
+    X(TREE_SITTER_VIM9_ANON_DOT_DOT_EQ, 13, "..=", false) \
+    X(TREE_SITTER_VIM9_ANON_PLUS_EQ, 14, "+=", false) \
+    X(TREE_SITTER_VIM9_ANON_DASH_EQ, 15, "-=", false) \
+    X(TREE_SITTER_VIM9_ANON_STAR_EQ, 16, "*=", false) \
+    X(TREE_SITTER_VIM9_ANON_SLASH_EQ, 17, "/=", false) \
+    X(TREE_SITTER_VIM9_SYM_SCOPE_VAR, 18, "scope_var", true) \
+    X(TREE_SITTER_VIM9_SYM_OPTION_VAR, 19, "option_var", true) \
+    X(TREE_SITTER_VIM9_ANON_LBRACK, 20, "[", false) \
+    X(TREE_SITTER_VIM9_ANON_RBRACK, 21, "]", false) \
+    X(TREE_SITTER_VIM9_ANON_LPAREN, 23, "(", false) \
+    X(TREE_SITTER_VIM9_ANON_RPAREN, 24, ")", false) \
+    X(TREE_SITTER_VIM9_ANON_COMMA, 25, ",", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_GT, 27, "=>", false) \
+    X(TREE_SITTER_VIM9_ANON_LBRACE, 28, "{", false) \
+    X(TREE_SITTER_VIM9_ANON_RBRACE, 29, "}", false) \
+    X(TREE_SITTER_VIM9_ANON_BOOL, 30, "bool", false) \
+    X(TREE_SITTER_VIM9_ANON_NUMBER, 31, "number", false) \
+    X(TREE_SITTER_VIM9_ANON_FLOAT, 32, "float", false) \
+    X(TREE_SITTER_VIM9_ANON_STRING, 33, "string", false) \
+    X(TREE_SITTER_VIM9_ANON_ANY, 34, "any", false) \
+    X(TREE_SITTER_VIM9_ANON_LIST, 35, "list", false) \
+    X(TREE_SITTER_VIM9_ANON_LT, 36, "<", false) \
+    X(TREE_SITTER_VIM9_ANON_GT, 37, ">", false) \
+    X(TREE_SITTER_VIM9_ANON_DICT, 38, "dict", false) \
+    X(TREE_SITTER_VIM9_SYM_NUMBER, 39, "number", true) \
+    X(TREE_SITTER_VIM9_SYM_FLOAT, 40, "float", true) \
+    X(TREE_SITTER_VIM9_SYM_BOOLEAN, 41, "boolean", true) \
+    X(TREE_SITTER_VIM9_SYM_STRING, 42, "string", true) \
+    X(TREE_SITTER_VIM9_ANON_BANG, 43, "!", false) \
+    X(TREE_SITTER_VIM9_ANON_DASH, 44, "-", false) \
+    X(TREE_SITTER_VIM9_ANON_DASH_GT, 45, "->", false) \
+    X(TREE_SITTER_VIM9_ANON_DOT_DOT, 46, "..", false) \
+    X(TREE_SITTER_VIM9_ANON_PLUS, 47, "+", false) \
+    X(TREE_SITTER_VIM9_ANON_STAR, 48, "*", false) \
+    X(TREE_SITTER_VIM9_ANON_SLASH, 49, "/", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_EQ, 50, "==", false) \
+    X(TREE_SITTER_VIM9_ANON_BANG_EQ, 51, "!=", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_EQ_POUND, 52, "==#", false) \
+    X(TREE_SITTER_VIM9_ANON_BANG_EQ_POUND, 53, "!=#", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_EQ_QMARK, 54, "==?", false) \
+    X(TREE_SITTER_VIM9_ANON_BANG_EQ_QMARK, 55, "!=?", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_TILDE, 56, "=~", false) \
+    X(TREE_SITTER_VIM9_ANON_BANG_TILDE, 57, "!~", false) \
+    X(TREE_SITTER_VIM9_ANON_EQ_TILDE_POUND, 58, "=~#", false) \
+    X(TREE_SITTER_VIM9_ANON_BANG_TILDE_POUND, 59, "!~#", false) \
+    X(TREE_SITTER_VIM9_ANON_GT_EQ, 60, ">=", false) \
+    X(TREE_SITTER_VIM9_ANON_LT_EQ, 61, "<=", false) \
+    X(TREE_SITTER_VIM9_ANON_AMP_AMP, 62, "&&", false) \
+    X(TREE_SITTER_VIM9_ANON_PIPE_PIPE, 63, "||", false) \
+    X(TREE_SITTER_VIM9_ANON_QMARK, 64, "?", false) \
+    X(TREE_SITTER_VIM9_SYM_CHAINABLE_STATEMENT, 65, "chainable_statement", true) \
+    X(TREE_SITTER_VIM9_SYM_STATEMENT_CHAIN, 66, "statement_chain", true) \
+    X(TREE_SITTER_VIM9_SYM_COMMENT, 67, "comment", true) \
+    X(TREE_SITTER_VIM9_SYM_COMMAND, 68, "command", true) \
+    X(TREE_SITTER_VIM9_SYM_SAFE_ARG, 69, "safe_arg", true) \
+    X(TREE_SITTER_VIM9_SYM_CONST_STATEMENT, 70, "const_statement", true) \
+    X(TREE_SITTER_VIM9_SYM_LET_STATEMENT, 71, "let_statement", true) \
+    X(TREE_SITTER_VIM9_SYM_ASSIGNMENT, 72, "assignment", true) \
+    X(TREE_SITTER_VIM9_SYM_AUGMENTED_ASSIGNMENT, 73, "augmented_assignment", true) \
+    X(TREE_SITTER_VIM9_SYM_LVALUE, 74, "lvalue", true) \
+    X(TREE_SITTER_VIM9_SYM_INDEX_EXPRESSION, 75, "index_expression", true) \
+    X(TREE_SITTER_VIM9_SYM_EXPR_STATEMENT, 76, "expr_statement", true) \
+    X(TREE_SITTER_VIM9_SYM_IDENTIFIER, 77, "identifier", true) \
+    X(TREE_SITTER_VIM9_SYM_FUNCTION_NAME, 78, "function_name", true) \
+    X(TREE_SITTER_VIM9_SYM_CALL_EXPRESSION, 79, "call_expression", true) \
+    X(TREE_SITTER_VIM9_SYM_ARGUMENTS, 80, "arguments", true) \
+    X(TREE_SITTER_VIM9_SYM_ARROW_FUNCTION, 81, "arrow_function", true) \
+    X(TREE_SITTER_VIM9_SYM_BLOCK, 82, "block", true) \
+    X(TREE_SITTER_VIM9_SYM_PARAMETER, 83, "parameter", true) \
+    X(TREE_SITTER_VIM9_SYM_TYPE, 84, "type", true) \
+    X(TREE_SITTER_VIM9_SYM_EXPR, 85, "expr", true) \
+    X(TREE_SITTER_VIM9_SYM_PARENTHESIZED_EXPRESSION, 86, "parenthesized_expression", true) \
+    X(TREE_SITTER_VIM9_SYM_LIST, 87, "list", true) \
+    X(TREE_SITTER_VIM9_SYM_PAIR, 88, "pair", true) \
+    X(TREE_SITTER_VIM9_SYM_DICT_KEY, 89, "dict_key", true) \
+    X(TREE_SITTER_VIM9_SYM_DICT, 90, "dict", true) \
+    X(TREE_SITTER_VIM9_SYM_UNARY_EXPRESSION, 91, "unary_expression", true) \
+    X(TREE_SITTER_VIM9_SYM_METHOD_CALL, 92, "method_call", true) \
+    X(TREE_SITTER_VIM9_SYM_BINARY_EXPRESSION, 93, "binary_expression", true) \
+    X(TREE_SITTER_VIM9_SYM_TERNARY_EXPRESSION, 94, "ternary_expression", true)
+
+// X(constant, id, name)
+#define TREE_SITTER_VIM9_FIELD_LIST(X)
+
+#endif // TREE_SITTER_VIM9_SYMBOLS_H_
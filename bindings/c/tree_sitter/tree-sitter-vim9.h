@@ -0,0 +1,428 @@
+#ifndef TREE_SITTER_VIM9_H_
+#define TREE_SITTER_VIM9_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct TSLanguage TSLanguage;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const TSLanguage *tree_sitter_vim9(void);
+
+// A bump allocator for batch jobs: parse, extract, throw everything away.
+//
+// Install the hooks once at startup, then bracket each job:
+//
+//     ts_set_allocator(tree_sitter_vim9_arena_malloc, tree_sitter_vim9_arena_calloc,
+//                      tree_sitter_vim9_arena_realloc, tree_sitter_vim9_arena_free);
+//     TreeSitterVim9Arena *arena = tree_sitter_vim9_arena_new(0);
+//     for (each file) {
+//         tree_sitter_vim9_arena_enter(arena);
+//         TSParser *parser = ts_parser_new();
+//         ... parse, walk the tree ...
+//         ts_tree_delete(tree);
+//         ts_parser_delete(parser);
+//         tree_sitter_vim9_arena_enter(NULL);
+//         tree_sitter_vim9_arena_reset(arena);
+//     }
+//
+// While an arena is entered on a thread, every runtime allocation on that
+// thread comes from it; free() is a no-op and reset releases the whole job at
+// once. Outside an arena the hooks fall through to malloc and friends, so the
+// hooks are safe to install globally. Everything allocated inside an arena,
+// including the parser, must be dropped before the reset and must never be
+// freed on another thread or outside the arena.
+//
+// Still delete the tree and the parser before the reset. Freeing a block the
+// arena owns costs nothing, but not every block is the arena's: the external
+// scanner's state comes from libc unless the library was built with
+// TREE_SITTER_REUSE_ALLOCATOR, and such blocks leak if the job just resets.
+typedef struct TreeSitterVim9Arena TreeSitterVim9Arena;
+
+// chunk_size 0 picks the default (1 MiB). A job that outgrows one chunk is
+// given a single chunk of the combined size after the next reset.
+TreeSitterVim9Arena *tree_sitter_vim9_arena_new(size_t chunk_size);
+void tree_sitter_vim9_arena_delete(TreeSitterVim9Arena *arena);
+void tree_sitter_vim9_arena_reset(TreeSitterVim9Arena *arena);
+
+// Makes `arena` (or NULL for the heap) current on the calling thread and
+// returns the previous one.
+TreeSitterVim9Arena *tree_sitter_vim9_arena_enter(TreeSitterVim9Arena *arena);
+
+// Largest number of bytes handed out between two resets so far.
+size_t tree_sitter_vim9_arena_peak(const TreeSitterVim9Arena *arena);
+
+void *tree_sitter_vim9_arena_malloc(size_t size);
+void *tree_sitter_vim9_arena_calloc(size_t count, size_t size);
+void *tree_sitter_vim9_arena_realloc(void *ptr, size_t size);
+void tree_sitter_vim9_arena_free(void *ptr);
+
+// The declarations of one file as filled in by tree_sitter_vim9_outline()
+// (tree-sitter-vim9-outline.h) and stored by the outline cache below.
+typedef enum {
+    TREE_SITTER_VIM9_OUTLINE_DEF = 1,
+    TREE_SITTER_VIM9_OUTLINE_VAR = 2,
+    TREE_SITTER_VIM9_OUTLINE_CONST = 3,
+} TreeSitterVim9OutlineKind;
+
+// flags[i]
+#define TREE_SITTER_VIM9_OUTLINE_EXPORTED 0x1
+
+// Entry i is described by the i-th element of every array. Entries are in
+// document order; parent[i] is the index of the enclosing def, or -1.
+// Name ranges are byte offsets into the parsed source, the rows and columns
+// span the whole declaration.
+typedef struct {
+    uint32_t count;
+    uint32_t capacity;
+    uint8_t *kind;
+    uint8_t *flags;
+    int32_t *parent;
+    uint32_t *name_start;
+    uint32_t *name_end;
+    uint32_t *start_row;
+    uint32_t *start_column;
+    uint32_t *end_row;
+    uint32_t *end_column;
+} TreeSitterVim9Outline;
+
+static inline void tree_sitter_vim9_outline_free(TreeSitterVim9Outline *outline) {
+    free(outline->kind);
+    free(outline->flags);
+    free(outline->parent);
+    free(outline->name_start);
+    free(outline->name_end);
+    free(outline->start_row);
+    free(outline->start_column);
+    free(outline->end_row);
+    free(outline->end_column);
+    memset(outline, 0, sizeof(*outline));
+}
+
+// On failure the arrays that did grow stay valid; capacity is unchanged.
+#define TREE_SITTER_VIM9_OUTLINE_GROW(array, type)                                \
+    do {                                                                          \
+        type *grown = (type *)realloc(outline->array, capacity * sizeof(type));   \
+        if (!grown) {                                                             \
+            return false;                                                         \
+        }                                                                         \
+        outline->array = grown;                                                   \
+    } while (0)
+
+static inline bool tree_sitter_vim9_outline_reserve(TreeSitterVim9Outline *outline,
+                                                    uint32_t capacity) {
+    if (capacity <= outline->capacity) {
+        return true;
+    }
+    TREE_SITTER_VIM9_OUTLINE_GROW(kind, uint8_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(flags, uint8_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(parent, int32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(name_start, uint32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(name_end, uint32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(start_row, uint32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(start_column, uint32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(end_row, uint32_t);
+    TREE_SITTER_VIM9_OUTLINE_GROW(end_column, uint32_t);
+    outline->capacity = capacity;
+    return true;
+}
+
+#undef TREE_SITTER_VIM9_OUTLINE_GROW
+
+// A persistent cache of outlines keyed by a hash of the file contents, so a
+// symbol index only parses the files that changed since it was written.
+//
+//     TreeSitterVim9Cache *cache = tree_sitter_vim9_cache_open(path);  // NULL: start cold
+//     TreeSitterVim9CacheWriter *writer = tree_sitter_vim9_cache_writer_new();
+//     for (each file) {
+//         uint64_t hash = tree_sitter_vim9_hash(source, length);
+//         if (!tree_sitter_vim9_cache_get(cache, hash, length, &outline, &info)) {
+//             ... parse, tree_sitter_vim9_outline() ...
+//         }
+//         tree_sitter_vim9_cache_writer_add(writer, hash, length, &outline, &info);
+//     }
+//     tree_sitter_vim9_cache_writer_commit(writer, path);
+//
+// The file is mapped read-only and looked up in place with a binary search,
+// so opening it costs the same for ten files or ten thousand. A cache written
+// by a different LANGUAGE_VERSION, grammar version (the language metadata) or
+// a grammar with different tables is rejected by open, as is a truncated or
+// foreign file. Lookups are safe from any number of threads; a writer belongs
+// to one thread.
+typedef struct TreeSitterVim9Cache TreeSitterVim9Cache;
+typedef struct TreeSitterVim9CacheWriter TreeSitterVim9CacheWriter;
+
+// Per-file facts kept next to the outline.
+typedef struct {
+    uint32_t node_count;
+    bool has_error;
+} TreeSitterVim9CacheInfo;
+
+// 64-bit hash of a source file, the cache key together with its length.
+uint64_t tree_sitter_vim9_hash(const void *data, size_t length);
+
+// Returns NULL (with errno set) when the file is missing, unreadable or stale.
+TreeSitterVim9Cache *tree_sitter_vim9_cache_open(const char *path);
+void tree_sitter_vim9_cache_close(TreeSitterVim9Cache *cache);
+uint32_t tree_sitter_vim9_cache_count(const TreeSitterVim9Cache *cache);
+
+// Copies the cached outline into `outline` (replacing its contents, like
+// tree_sitter_vim9_outline() does) and fills `info` if it isn't NULL. A NULL
+// cache simply misses.
+bool tree_sitter_vim9_cache_get(const TreeSitterVim9Cache *cache, uint64_t hash,
+                                uint32_t length, TreeSitterVim9Outline *outline,
+                                TreeSitterVim9CacheInfo *info);
+
+TreeSitterVim9CacheWriter *tree_sitter_vim9_cache_writer_new(void);
+void tree_sitter_vim9_cache_writer_delete(TreeSitterVim9CacheWriter *writer);
+bool tree_sitter_vim9_cache_writer_add(TreeSitterVim9CacheWriter *writer, uint64_t hash,
+                                       uint32_t length, const TreeSitterVim9Outline *outline,
+                                       const TreeSitterVim9CacheInfo *info);
+
+// Writes everything added so far to `path` via a temporary file and a
+// rename, so readers never see a half-written cache and a cache that is
+// still mapped stays valid. Only the entries added to this writer are kept.
+bool tree_sitter_vim9_cache_writer_commit(TreeSitterVim9CacheWriter *writer, const char *path);
+
+// Finds the places where a file can be cut into pieces that parse on their
+// own: the start of a line after a newline with no def, function, if, for,
+// while or try open, no bracket open, no heredoc in progress, and a next line
+// that isn't a continuation (\, ->, .., &&, ||, +, ?, :). The scan works on a
+// growing buffer, so huge inputs can be cut while they are being read
+// (tree-sitter-vim9-stream.h does that):
+//
+//     TreeSitterVim9Splitter splitter;
+//     tree_sitter_vim9_splitter_init(&splitter);
+//     for (;;) {
+//         ... append input to buffer, note whether it was the last of it ...
+//         uint32_t cut = tree_sitter_vim9_splitter_scan(&splitter, buffer, length, at_eof);
+//         ... buffer[0, cut) is a self-contained piece ...
+//         tree_sitter_vim9_splitter_consume(&splitter, cut);
+//         ... drop the first `cut` bytes of buffer ...
+//     }
+//
+// Only whole lines are scanned, and each byte only once. The keywords and
+// brackets are recognized lexically (strings, comments, mapping and
+// highlight arguments are skipped), so a construct the splitter
+// misjudges only makes a piece larger, never cuts one apart: everything up
+// to a cut is balanced.
+typedef struct {
+    uint32_t scanned;   // bytes of the buffer already scanned
+    uint32_t boundary;  // the last cut found so far
+    uint32_t brackets;
+    uint32_t blocks;
+    bool pending;  // a cut at `scanned` waits for the next line's first characters
+    bool heredoc;
+    bool heredoc_trim;
+    uint8_t marker_length;
+    char marker[64];
+} TreeSitterVim9Splitter;
+
+void tree_sitter_vim9_splitter_init(TreeSitterVim9Splitter *splitter);
+
+// Scans the lines of data[splitter->scanned, length) and returns the last cut
+// in data[0, length), or 0 if there is none yet. With `at_eof` the end of the
+// data is a cut too, so the result is `length`.
+uint32_t tree_sitter_vim9_splitter_scan(TreeSitterVim9Splitter *splitter, const char *data,
+                                        uint32_t length, bool at_eof);
+
+// Tells the splitter the first `length` bytes (at most the last cut) were
+// removed from the front of the buffer.
+void tree_sitter_vim9_splitter_consume(TreeSitterVim9Splitter *splitter, uint32_t length);
+
+#ifdef TREE_SITTER_PROFILE
+// Lexer counters of a TREE_SITTER_PROFILE build (see bindings/c/profile.c),
+// kept per thread: the calling thread's state visits, ADVANCE_MAP scan
+// lengths (a dense ADVANCE_TABLE lookup counts as one step) and accepted tokens as a malloc'd JSON object (NULL when memory
+// runs out), and clearing them for the calling thread.
+char *tree_sitter_vim9_profile_json(void);
+void tree_sitter_vim9_profile_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+// Parsing straight out of a memory-mapped file. These helpers call into the
+// tree-sitter runtime, so they are only compiled when the including file
+// defines TREE_SITTER_VIM9_PARSE_FILE and links against libtree-sitter. With
+// a strict -std=c11 the POSIX declarations need _POSIX_C_SOURCE 200809L too.
+#ifdef TREE_SITTER_VIM9_PARSE_FILE
+
+#include <tree_sitter/api.h>
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A read-only mapping of a source file. `data` points into the mapping and
+// stays valid until tree_sitter_vim9_file_close(); node byte offsets are
+// offsets into it.
+typedef struct {
+    const char *data;
+    uint32_t length;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+} TreeSitterVim9File;
+
+// Maps `path`. Returns false and sets errno on failure. An empty file is not
+// mapped at all; `data` then points to an empty string.
+static inline bool tree_sitter_vim9_file_open(TreeSitterVim9File *file, const char *path) {
+    file->data = "";
+    file->length = 0;
+#ifdef _WIN32
+    file->mapping = NULL;
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        errno = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart > UINT32_MAX) {
+        CloseHandle(handle);
+        errno = EFBIG;
+        return false;
+    }
+    if (size.QuadPart > 0) {
+        file->mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        const void *view =
+            file->mapping ? MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+        if (!view) {
+            if (file->mapping) {
+                CloseHandle(file->mapping);
+                file->mapping = NULL;
+            }
+            CloseHandle(handle);
+            errno = EIO;
+            return false;
+        }
+        file->data = (const char *)view;
+        file->length = (uint32_t)size.QuadPart;
+    }
+    CloseHandle(handle);
+    return true;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    if ((uint64_t)st.st_size > UINT32_MAX) {
+        close(fd);
+        errno = EFBIG;
+        return false;
+    }
+    if (st.st_size > 0) {
+        void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        // The lexer reads the file front to back exactly once.
+        posix_madvise(data, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+        file->data = (const char *)data;
+        file->length = (uint32_t)st.st_size;
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+static inline void tree_sitter_vim9_file_close(TreeSitterVim9File *file) {
+    if (file->length > 0) {
+#ifdef _WIN32
+        UnmapViewOfFile(file->data);
+        CloseHandle(file->mapping);
+#else
+        munmap((void *)file->data, file->length);
+#endif
+    }
+    file->data = "";
+    file->length = 0;
+}
+
+// TSInput callback: hands the lexer everything from `byte` to the end of the
+// mapping at once, so nothing is copied.
+static inline const char *tree_sitter_vim9_file_read(void *payload, uint32_t byte,
+                                                     TSPoint position, uint32_t *bytes_read) {
+    const TreeSitterVim9File *file = (const TreeSitterVim9File *)payload;
+    (void)position;
+    if (byte >= file->length) {
+        *bytes_read = 0;
+        return "";
+    }
+    *bytes_read = file->length - byte;
+    return file->data + byte;
+}
+
+static inline TSTree *tree_sitter_vim9_file_parse(TSParser *parser, const TSTree *old_tree,
+                                                  const TreeSitterVim9File *file) {
+    TSInput input;
+    memset(&input, 0, sizeof(input));
+    input.payload = (void *)file;
+    input.read = tree_sitter_vim9_file_read;
+    input.encoding = TSInputEncodingUTF8;
+    return ts_parser_parse(parser, old_tree, input);
+}
+
+// Parses `path` and unmaps it again before returning. Use this when only the
+// tree's shape is needed; node text can no longer be read from the file.
+// Returns NULL and sets errno when the file can't be mapped.
+static inline TSTree *tree_sitter_vim9_parse_file(TSParser *parser, const char *path) {
+    TreeSitterVim9File file;
+    if (!tree_sitter_vim9_file_open(&file, path)) {
+        return NULL;
+    }
+    TSTree *tree = tree_sitter_vim9_file_parse(parser, NULL, &file);
+    tree_sitter_vim9_file_close(&file);
+    return tree;
+}
+
+// Like tree_sitter_vim9_parse_file(), but leaves the mapping open in `file`
+// so node text can be sliced out of file->data and the tree can be reparsed
+// incrementally. Call tree_sitter_vim9_file_close() once the tree is deleted.
+static inline TSTree *tree_sitter_vim9_parse_file_mapped(TSParser *parser, const char *path,
+                                                         TreeSitterVim9File *file) {
+    if (!tree_sitter_vim9_file_open(file, path)) {
+        return NULL;
+    }
+    TSTree *tree = tree_sitter_vim9_file_parse(parser, NULL, file);
+    if (!tree) {
+        tree_sitter_vim9_file_close(file);
+    }
+    return tree;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VIM9_PARSE_FILE
+
+#endif // TREE_SITTER_VIM9_H_
@@ -1,6 +1,9 @@
 package tree_sitter_vim_test
 
 import (
+	"context"
+	"os"
+	"path/filepath"
 	"testing"
 
 	tree_sitter "github.com/tree-sitter/go-tree-sitter"
@@ -13,3 +16,121 @@ func TestCanLoadGrammar(t *testing.T) {
 		t.Errorf("Error loading Vim grammar")
 	}
 }
+
+func corpus(tb testing.TB) []string {
+	paths, err := filepath.Glob("../../bench/corpus/*.vim")
+	if err != nil || len(paths) == 0 {
+		tb.Skip("bench/corpus is empty")
+	}
+	return paths
+}
+
+func TestParseFiles(t *testing.T) {
+	paths := append(corpus(t), "does-not-exist.vim")
+	seen := 0
+	for result := range tree_sitter_vim.ParseFiles(context.Background(), paths, 2) {
+		seen++
+		if result.Path == "does-not-exist.vim" {
+			if result.Err == nil {
+				t.Errorf("expected an error for %s", result.Path)
+			}
+			continue
+		}
+		if result.Err != nil {
+			t.Fatal(result.Err)
+		}
+		if result.Tree.RootNode().HasError() {
+			t.Errorf("%s has syntax errors", result.Path)
+		}
+		result.Tree.Close()
+	}
+	if seen != len(paths) {
+		t.Errorf("got %d results, want %d", seen, len(paths))
+	}
+}
+
+func TestParseFilesCancel(t *testing.T) {
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	for result := range tree_sitter_vim.ParseFiles(ctx, corpus(t), 2) {
+		if result.Tree != nil {
+			result.Tree.Close()
+		}
+	}
+}
+
+func benchSource(b *testing.B) []byte {
+	source, err := os.ReadFile(corpus(b)[0])
+	if err != nil {
+		b.Fatal(err)
+	}
+	return source
+}
+
+// A new parser per parse: what a service pays without pooling.
+func BenchmarkParseNewParser(b *testing.B) {
+	source := benchSource(b)
+	language := tree_sitter.NewLanguage(tree_sitter_vim.Language())
+	b.SetBytes(int64(len(source)))
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		parser := tree_sitter.NewParser()
+		parser.SetLanguage(language)
+		parser.Parse(source, nil).Close()
+		parser.Close()
+	}
+}
+
+func BenchmarkParsePooled(b *testing.B) {
+	source := benchSource(b)
+	pool := tree_sitter_vim.NewParserPool()
+	b.SetBytes(int64(len(source)))
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		pool.Parse(source, nil).Close()
+	}
+}
+
+func BenchmarkParsePooledParallel(b *testing.B) {
+	source := benchSource(b)
+	pool := tree_sitter_vim.NewParserPool()
+	b.SetBytes(int64(len(source)))
+	b.ReportAllocs()
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			pool.Parse(source, nil).Close()
+		}
+	})
+}
+
+// The cgo round trip alone, without parsing anything.
+func BenchmarkParseEmpty(b *testing.B) {
+	empty := []byte("\n")
+	pool := tree_sitter_vim.NewParserPool()
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		pool.Parse(empty, nil).Close()
+	}
+}
+
+func BenchmarkParseFiles(b *testing.B) {
+	paths := corpus(b)
+	var bytes int64
+	for _, path := range paths {
+		info, err := os.Stat(path)
+		if err != nil {
+			b.Fatal(err)
+		}
+		bytes += info.Size()
+	}
+	b.SetBytes(bytes)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for result := range tree_sitter_vim.ParseFiles(context.Background(), paths, 0) {
+			if result.Err != nil {
+				b.Fatal(result.Err)
+			}
+			result.Tree.Close()
+		}
+	}
+}
@@ -0,0 +1,123 @@
+package tree_sitter_vim
+
+import (
+	"context"
+	"os"
+	"runtime"
+	"sync"
+
+	tree_sitter "github.com/tree-sitter/go-tree-sitter"
+)
+
+// PooledParser is a parser already configured for this grammar.
+type PooledParser struct {
+	*tree_sitter.Parser
+}
+
+// ParserPool hands out configured parsers so that callers don't pay for
+// ts_parser_new and SetLanguage on every parse. It is safe for concurrent use.
+//
+// Parsers dropped by the underlying sync.Pool are closed by a finalizer, so
+// forgetting to Put one only costs a new parser later.
+type ParserPool struct {
+	language *tree_sitter.Language
+	pool     sync.Pool
+}
+
+// NewParserPool returns an empty pool; parsers are created on demand.
+func NewParserPool() *ParserPool {
+	p := &ParserPool{language: tree_sitter.NewLanguage(Language())}
+	p.pool.New = func() any {
+		parser := &PooledParser{tree_sitter.NewParser()}
+		if err := parser.SetLanguage(p.language); err != nil {
+			// Only an ABI mismatch between parser.c and go-tree-sitter gets here.
+			panic(err)
+		}
+		runtime.SetFinalizer(parser, func(parser *PooledParser) { parser.Close() })
+		return parser
+	}
+	return p
+}
+
+// Get takes a parser out of the pool, creating one if the pool is empty.
+func (p *ParserPool) Get() *PooledParser {
+	return p.pool.Get().(*PooledParser)
+}
+
+// Put resets the parser and returns it to the pool.
+func (p *ParserPool) Put(parser *PooledParser) {
+	parser.Reset()
+	p.pool.Put(parser)
+}
+
+// Parse parses source with a pooled parser. The caller owns the returned tree.
+func (p *ParserPool) Parse(source []byte, oldTree *tree_sitter.Tree) *tree_sitter.Tree {
+	parser := p.Get()
+	defer p.Put(parser)
+	return parser.Parse(source, oldTree)
+}
+
+// FileResult is one parsed file from ParseFiles. When Err is nil the receiver
+// owns Tree and must Close it.
+type FileResult struct {
+	Path   string
+	Source []byte
+	Tree   *tree_sitter.Tree
+	Err    error
+}
+
+// ParseFiles reads and parses paths on workers goroutines (one per CPU when
+// workers <= 0) and streams the results in completion order. The channel is
+// closed once every path has been handled or ctx is cancelled; results that
+// can no longer be delivered after cancellation are closed, not leaked.
+func ParseFiles(ctx context.Context, paths []string, workers int) <-chan FileResult {
+	if workers <= 0 {
+		workers = runtime.GOMAXPROCS(0)
+	}
+	if workers > len(paths) {
+		workers = len(paths)
+	}
+	results := make(chan FileResult, workers)
+	jobs := make(chan string)
+	pool := NewParserPool()
+
+	var wg sync.WaitGroup
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			// Each goroutine keeps one parser for its whole run.
+			parser := pool.Get()
+			defer pool.Put(parser)
+			for path := range jobs {
+				result := FileResult{Path: path}
+				result.Source, result.Err = os.ReadFile(path)
+				if result.Err == nil {
+					result.Tree = parser.Parse(result.Source, nil)
+				}
+				select {
+				case results <- result:
+				case <-ctx.Done():
+					if result.Tree != nil {
+						result.Tree.Close()
+					}
+				}
+			}
+		}()
+	}
+
+	go func() {
+		defer close(results)
+	feed:
+		for _, path := range paths {
+			select {
+			case jobs <- path:
+			case <-ctx.Done():
+				break feed
+			}
+		}
+		close(jobs)
+		wg.Wait()
+	}()
+	return results
+}
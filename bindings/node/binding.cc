@@ -1,18 +1,326 @@
 #include <napi.h>
 
-typedef struct TSLanguage TSLanguage;
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9-changes.h>
+#include <tree_sitter/tree-sitter-vim9-outline.h>
+#include <tree_sitter/tree-sitter-vim9.h>
 
-extern "C" TSLanguage *tree_sitter_vim();
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
 
 // "tree-sitter", "language" hashed with BLAKE2
 const napi_type_tag LANGUAGE_TYPE_TAG = {
     0x8AF2E5212AD58ABF, 0xD5006CAD83ABBA16
 };
 
+namespace {
+
+// Parsers are reused between parseAsync() calls; a parser is only ever used
+// by one libuv worker at a time, the language itself is shared and immutable.
+class ParserPool {
+  public:
+    // Returns nullptr when the runtime compiled into the addon can't load the
+    // grammar (its ABI version is outside what the runtime supports).
+    TSParser *Acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!idle_.empty()) {
+                TSParser *parser = idle_.back();
+                idle_.pop_back();
+                return parser;
+            }
+        }
+        TSParser *parser = ts_parser_new();
+        if (!ts_parser_set_language(parser, tree_sitter_vim9())) {
+            ts_parser_delete(parser);
+            return nullptr;
+        }
+        return parser;
+    }
+
+    void Release(TSParser *parser) {
+        ts_parser_reset(parser);
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_.push_back(parser);
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<TSParser *> idle_;
+};
+
+ParserPool parser_pool;
+
+Napi::Object PointToObject(Napi::Env env, TSPoint point) {
+    auto object = Napi::Object::New(env);
+    object["row"] = point.row;
+    object["column"] = point.column;
+    return object;
+}
+
+TSPoint PointFromObject(const Napi::Value &value) {
+    auto object = value.As<Napi::Object>();
+    return {object.Get("row").As<Napi::Number>().Uint32Value(),
+            object.Get("column").As<Napi::Number>().Uint32Value()};
+}
+
+// A parsed tree. Offsets are UTF-8 byte offsets into the parsed source.
+class Tree : public Napi::ObjectWrap<Tree> {
+  public:
+    // The constructor is per environment (main thread and each worker thread).
+    static Napi::Function Constructor(Napi::Env env) {
+        return env.GetInstanceData<Napi::FunctionReference>()->Value();
+    }
+
+    static bool IsTree(Napi::Value value) {
+        return value.IsObject() && value.As<Napi::Object>().InstanceOf(Constructor(value.Env()));
+    }
+
+    static void Init(Napi::Env env, Napi::Object exports) {
+        auto func = DefineClass(env, "Tree", {
+            InstanceMethod<&Tree::Edit>("edit"),
+            InstanceMethod<&Tree::GetChangedRanges>("getChangedRanges"),
+            InstanceMethod<&Tree::ChangedLines>("changedLines"),
+            InstanceMethod<&Tree::ToString>("toString"),
+            InstanceMethod<&Tree::Outline>("outline"),
+            InstanceAccessor<&Tree::HasError>("hasError"),
+            InstanceAccessor<&Tree::NodeCount>("nodeCount"),
+        });
+        env.SetInstanceData(new Napi::FunctionReference(Napi::Persistent(func)));
+        exports["Tree"] = func;
+    }
+
+    static Napi::Object Wrap(Napi::Env env, TSTree *tree) {
+        auto object = Constructor(env).New({});
+        Napi::ObjectWrap<Tree>::Unwrap(object)->tree_ = tree;
+        return object;
+    }
+
+    explicit Tree(const Napi::CallbackInfo &info) : Napi::ObjectWrap<Tree>(info) {}
+
+    ~Tree() override {
+        if (tree_) {
+            ts_tree_delete(tree_);
+        }
+    }
+
+    TSTree *Get() const { return tree_; }
+
+  private:
+    // Trees only come from parseAsync(); `new Tree()` from JS has nothing inside.
+    TSTree *Checked(Napi::Env env) const {
+        if (!tree_) {
+            throw Napi::Error::New(env, "Tree is empty; trees are created by parseAsync()");
+        }
+        return tree_;
+    }
+
+    Napi::Value Edit(const Napi::CallbackInfo &info) {
+        Checked(info.Env());
+        auto edit = info[0].As<Napi::Object>();
+        TSInputEdit input = {
+            edit.Get("startIndex").As<Napi::Number>().Uint32Value(),
+            edit.Get("oldEndIndex").As<Napi::Number>().Uint32Value(),
+            edit.Get("newEndIndex").As<Napi::Number>().Uint32Value(),
+            PointFromObject(edit.Get("startPosition")),
+            PointFromObject(edit.Get("oldEndPosition")),
+            PointFromObject(edit.Get("newEndPosition")),
+        };
+        ts_tree_edit(tree_, &input);
+        return info.This();
+    }
+
+    Napi::Value GetChangedRanges(const Napi::CallbackInfo &info) {
+        auto env = info.Env();
+        if (!IsTree(info[0])) {
+            throw Napi::TypeError::New(env, "getChangedRanges expects a Tree");
+        }
+        TSTree *other = Napi::ObjectWrap<Tree>::Unwrap(info[0].As<Napi::Object>())->Checked(env);
+        uint32_t count;
+        TSRange *ranges = ts_tree_get_changed_ranges(Checked(env), other, &count);
+        auto result = Napi::Array::New(env, count);
+        for (uint32_t i = 0; i < count; i++) {
+            auto range = Napi::Object::New(env);
+            range["startIndex"] = ranges[i].start_byte;
+            range["endIndex"] = ranges[i].end_byte;
+            range["startPosition"] = PointToObject(env, ranges[i].start_point);
+            range["endPosition"] = PointToObject(env, ranges[i].end_point);
+            result[i] = range;
+        }
+        free(ranges);
+        return result;
+    }
+
+    // tree_sitter_vim9_changed_lines() as one Uint32Array of
+    // [startRow, endRow, startIndex, endIndex] quadruples.
+    Napi::Value ChangedLines(const Napi::CallbackInfo &info) {
+        auto env = info.Env();
+        if (!IsTree(info[0])) {
+            throw Napi::TypeError::New(env, "changedLines expects a Tree");
+        }
+        TSTree *other = Napi::ObjectWrap<Tree>::Unwrap(info[0].As<Napi::Object>())->Checked(env);
+        TreeSitterVim9LineSpans spans = {};
+        uint32_t count = tree_sitter_vim9_changed_lines(Checked(env), other, &spans);
+        if (count == UINT32_MAX) {
+            tree_sitter_vim9_line_spans_free(&spans);
+            throw Napi::Error::New(env, "out of memory");
+        }
+        auto result = CopyColumn<Napi::Uint32Array>(
+            env, reinterpret_cast<const uint32_t *>(spans.spans), count * 4);
+        tree_sitter_vim9_line_spans_free(&spans);
+        return result;
+    }
+
+    Napi::Value ToString(const Napi::CallbackInfo &info) {
+        char *string = ts_node_string(ts_tree_root_node(Checked(info.Env())));
+        auto result = Napi::String::New(info.Env(), string);
+        free(string);
+        return result;
+    }
+
+    // One typed array per column of TreeSitterVim9Outline, copied out in one
+    // go; entry i is element i of every array.
+    Napi::Value Outline(const Napi::CallbackInfo &info) {
+        auto env = info.Env();
+        TreeSitterVim9Outline outline = {};
+        uint32_t count = tree_sitter_vim9_outline(Checked(env), &outline);
+        if (count == UINT32_MAX) {
+            tree_sitter_vim9_outline_free(&outline);
+            throw Napi::Error::New(env, "out of memory");
+        }
+        auto result = Napi::Object::New(env);
+        result["count"] = count;
+        result["kind"] = CopyColumn<Napi::Uint8Array>(env, outline.kind, count);
+        result["flags"] = CopyColumn<Napi::Uint8Array>(env, outline.flags, count);
+        result["parent"] = CopyColumn<Napi::Int32Array>(env, outline.parent, count);
+        result["nameStart"] = CopyColumn<Napi::Uint32Array>(env, outline.name_start, count);
+        result["nameEnd"] = CopyColumn<Napi::Uint32Array>(env, outline.name_end, count);
+        result["startRow"] = CopyColumn<Napi::Uint32Array>(env, outline.start_row, count);
+        result["startColumn"] = CopyColumn<Napi::Uint32Array>(env, outline.start_column, count);
+        result["endRow"] = CopyColumn<Napi::Uint32Array>(env, outline.end_row, count);
+        result["endColumn"] = CopyColumn<Napi::Uint32Array>(env, outline.end_column, count);
+        tree_sitter_vim9_outline_free(&outline);
+        return result;
+    }
+
+    template <typename Array, typename T>
+    static Array CopyColumn(Napi::Env env, const T *data, uint32_t count) {
+        auto array = Array::New(env, count);
+        if (count > 0) {
+            std::memcpy(array.Data(), data, count * sizeof(T));
+        }
+        return array;
+    }
+
+    Napi::Value HasError(const Napi::CallbackInfo &info) {
+        TSNode root = ts_tree_root_node(Checked(info.Env()));
+        return Napi::Boolean::New(info.Env(), ts_node_has_error(root));
+    }
+
+    Napi::Value NodeCount(const Napi::CallbackInfo &info) {
+        TSNode root = ts_tree_root_node(Checked(info.Env()));
+        return Napi::Number::New(info.Env(), ts_node_descendant_count(root));
+    }
+
+    TSTree *tree_ = nullptr;
+};
+
+// Runs one parse on the libuv thread pool. The source is copied and the old
+// tree is shallow-copied up front, so JS may keep using both meanwhile.
+class ParseWorker : public Napi::AsyncWorker {
+  public:
+    ParseWorker(Napi::Env env, std::string source, TSTree *old_tree)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
+          source_(std::move(source)), old_tree_(old_tree) {}
+
+    ~ParseWorker() override {
+        if (old_tree_) {
+            ts_tree_delete(old_tree_);
+        }
+        if (tree_) {
+            ts_tree_delete(tree_);
+        }
+    }
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+    void Execute() override {
+        TSParser *parser = parser_pool.Acquire();
+        if (!parser) {
+            SetError("tree-sitter-vim9 has language ABI version " +
+                     std::to_string(ts_language_abi_version(tree_sitter_vim9())) +
+                     ", but the tree-sitter runtime built into the addon supports " +
+                     std::to_string(TREE_SITTER_MIN_COMPATIBLE_LANGUAGE_VERSION) + " to " +
+                     std::to_string(TREE_SITTER_LANGUAGE_VERSION));
+            return;
+        }
+        tree_ = ts_parser_parse_string(parser, old_tree_, source_.data(),
+                                       static_cast<uint32_t>(source_.size()));
+        parser_pool.Release(parser);
+        if (!tree_) {
+            SetError("parse failed");
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(Tree::Wrap(Env(), tree_));
+        tree_ = nullptr;
+    }
+
+    void OnError(const Napi::Error &error) override { deferred_.Reject(error.Value()); }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    std::string source_;
+    TSTree *old_tree_;
+    TSTree *tree_ = nullptr;
+};
+
+// parseAsync(source: string | Buffer, oldTree?: Tree): Promise<Tree>
+Napi::Value ParseAsync(const Napi::CallbackInfo &info) {
+    auto env = info.Env();
+    std::string source;
+    if (info[0].IsString()) {
+        source = info[0].As<Napi::String>().Utf8Value();
+    } else if (info[0].IsBuffer()) {
+        auto buffer = info[0].As<Napi::Buffer<char>>();
+        source.assign(buffer.Data(), buffer.Length());
+    } else {
+        throw Napi::TypeError::New(env, "parseAsync expects a string or Buffer");
+    }
+    if (source.size() > UINT32_MAX) {
+        throw Napi::RangeError::New(env, "source is larger than 4 GiB");
+    }
+
+    TSTree *old_tree = nullptr;
+    if (info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull()) {
+        if (!Tree::IsTree(info[1]) ||
+            !Napi::ObjectWrap<Tree>::Unwrap(info[1].As<Napi::Object>())->Get()) {
+            throw Napi::TypeError::New(env, "oldTree must be a Tree returned by parseAsync");
+        }
+        old_tree = ts_tree_copy(Napi::ObjectWrap<Tree>::Unwrap(info[1].As<Napi::Object>())->Get());
+    }
+
+    auto *worker = new ParseWorker(env, std::move(source), old_tree);
+    auto promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+} // namespace
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
-    auto language = Napi::External<TSLanguage>::New(env, tree_sitter_vim());
+    // The language is immutable; node-tree-sitter just wants a plain pointer.
+    auto language =
+        Napi::External<TSLanguage>::New(env, const_cast<TSLanguage *>(tree_sitter_vim9()));
     language.TypeTag(&LANGUAGE_TYPE_TAG);
     exports["language"] = language;
+    Tree::Init(env, exports);
+    exports["parseAsync"] = Napi::Function::New(env, ParseAsync, "parseAsync");
     return exports;
 }
 
@@ -7,3 +7,50 @@ test("can load grammar", () => {
   const parser = new Parser();
   assert.doesNotThrow(() => parser.setLanguage(require(".")));
 });
+
+test("can parse off the main thread", async () => {
+  const { parseAsync } = require(".");
+  const source = "vim9script\nvar x = 1\n";
+  const tree = await parseAsync(source);
+  assert.strictEqual(tree.hasError, false);
+  assert.match(tree.toString(), /^\(source_file/);
+
+  const edited = source.replace("1", "10");
+  tree.edit({
+    startIndex: 19, oldEndIndex: 20, newEndIndex: 21,
+    startPosition: { row: 1, column: 8 },
+    oldEndPosition: { row: 1, column: 9 },
+    newEndPosition: { row: 1, column: 10 },
+  });
+  const next = await parseAsync(Buffer.from(edited), tree);
+  assert.strictEqual(next.hasError, false);
+  assert.ok(Array.isArray(tree.getChangedRanges(next)));
+});
+
+test("changed lines cover the edited statement", async () => {
+  const { parseAsync } = require(".");
+  const source = "vim9script\nvar x = 1\nvar y = 2\n";
+  const tree = await parseAsync(source);
+  tree.edit({
+    startIndex: 19, oldEndIndex: 20, newEndIndex: 21,
+    startPosition: { row: 1, column: 8 },
+    oldEndPosition: { row: 1, column: 9 },
+    newEndPosition: { row: 1, column: 10 },
+  });
+  const next = await parseAsync(source.replace("1", "10"), tree);
+  const lines = tree.changedLines(next);
+  assert.ok(lines instanceof Uint32Array);
+  assert.deepStrictEqual(Array.from(lines.subarray(0, 3)), [1, 1, 11]);
+});
+
+test("can outline a tree", async () => {
+  const { parseAsync } = require(".");
+  const source = "vim9script\nexport def F()\n  var y = 2\nenddef\nconst Z = 3\n";
+  const outline = (await parseAsync(source)).outline();
+  assert.strictEqual(outline.count, 3);
+  assert.deepStrictEqual(Array.from(outline.kind), [1, 2, 3]);
+  assert.deepStrictEqual(Array.from(outline.flags), [1, 0, 0]);
+  assert.deepStrictEqual(Array.from(outline.parent), [-1, 0, -1]);
+  const name = (i) => source.slice(outline.nameStart[i], outline.nameEnd[i]);
+  assert.deepStrictEqual([0, 1, 2].map(name), ["F", "y", "Z"]);
+});
@@ -18,9 +18,71 @@ type NodeInfo =
       children: ChildNode[];
     });
 
+type Point = {
+  row: number;
+  column: number;
+};
+
+/** Offsets are UTF-8 byte offsets into the parsed source. */
+type Edit = {
+  startIndex: number;
+  oldEndIndex: number;
+  newEndIndex: number;
+  startPosition: Point;
+  oldEndPosition: Point;
+  newEndPosition: Point;
+};
+
+type Range = {
+  startIndex: number;
+  endIndex: number;
+  startPosition: Point;
+  endPosition: Point;
+};
+
+/**
+ * The declarations of a tree as parallel columns: entry i is element i of
+ * every array. kind is 1 = def, 2 = var, 3 = const; bit 0 of flags marks an
+ * exported def; parent is the index of the enclosing def or -1. nameStart and
+ * nameEnd are UTF-8 byte offsets into the parsed source.
+ */
+type Outline = {
+  count: number;
+  kind: Uint8Array;
+  flags: Uint8Array;
+  parent: Int32Array;
+  nameStart: Uint32Array;
+  nameEnd: Uint32Array;
+  startRow: Uint32Array;
+  startColumn: Uint32Array;
+  endRow: Uint32Array;
+  endColumn: Uint32Array;
+};
+
+/** A tree returned by parseAsync(); not a node-tree-sitter Tree. */
+declare class Tree {
+  private constructor();
+  readonly hasError: boolean;
+  readonly nodeCount: number;
+  edit(edit: Edit): Tree;
+  getChangedRanges(other: Tree): Range[];
+  /**
+   * The lines to re-highlight after reparsing this (edited) tree into
+   * `other`: changed ranges and edits widened to whole statements and merged,
+   * as [startRow, endRow, startIndex, endIndex] quadruples. endRow is
+   * inclusive.
+   */
+  changedLines(other: Tree): Uint32Array;
+  toString(): string;
+  outline(): Outline;
+}
+
 type Language = {
   language: unknown;
   nodeTypeInfo: NodeInfo[];
+  Tree: typeof Tree;
+  /** Parses on the libuv thread pool; strings are parsed as UTF-8. */
+  parseAsync(source: string | Buffer, oldTree?: Tree): Promise<Tree>;
 };
 
 declare const language: Language;
@@ -1,3 +1,5 @@
+from os import path
+from tempfile import TemporaryDirectory
 from unittest import TestCase
 
 from tree_sitter import Language, Parser
@@ -10,3 +12,110 @@ class TestLanguage(TestCase):
             Parser(Language(tree_sitter_vim.language()))
         except Exception:
             self.fail("Error loading Vim grammar")
+
+    def test_queries_compile(self):
+        language = Language(tree_sitter_vim.language())
+        for name in ("HIGHLIGHTS_QUERY", "LOCALS_QUERY", "FOLDS_QUERY", "INJECTIONS_QUERY"):
+            with self.subTest(name):
+                language.query(getattr(tree_sitter_vim, name))
+
+    def test_parse_many(self):
+        sources = [b"vim9script\nvar x = 1\n", b"def F()\nenddef\n"] * 8
+        try:
+            results = tree_sitter_vim.parse_many(sources, threads=4)
+        except NotImplementedError:
+            self.skipTest("built without the tree-sitter runtime")
+        self.assertEqual(len(results), len(sources))
+        for source, result in zip(sources, results):
+            self.assertFalse(result["has_error"])
+            self.assertEqual(result["byte_length"], len(source))
+
+    def test_parse_many_outline(self):
+        source = b"vim9script\nexport def F()\n  var y = 2\nenddef\nconst Z = 3\n"
+        try:
+            (result,) = tree_sitter_vim.parse_many([source], outline=True)
+        except NotImplementedError:
+            self.skipTest("built without the tree-sitter runtime")
+        outline = result["outline"]
+        self.assertEqual(outline["kind"].tolist(), [1, 2, 3])
+        self.assertEqual(outline["flags"].tolist(), [1, 0, 0])
+        self.assertEqual(outline["parent"].tolist(), [-1, 0, -1])
+        names = [
+            source[start:end]
+            for start, end in zip(outline["name_start"], outline["name_end"])
+        ]
+        self.assertEqual(names, [b"F", b"y", b"Z"])
+
+    def test_parse_many_cache(self):
+        sources = [b"vim9script\nvar x = 1\n", b"def F()\nenddef\n"]
+        with TemporaryDirectory() as directory:
+            cache = path.join(directory, "outline.cache")
+            try:
+                cold = tree_sitter_vim.parse_many(sources, outline=True, cache=cache)
+            except NotImplementedError:
+                self.skipTest("built without the tree-sitter runtime")
+            self.assertFalse(any(result["cached"] for result in cold))
+            changed = sources + [b"const Y = 2\n"]
+            warm = tree_sitter_vim.parse_many(changed, outline=True, cache=cache)
+            self.assertEqual([result["cached"] for result in warm], [True, True, False])
+            for before, after in zip(cold, warm):
+                self.assertEqual(before["node_count"], after["node_count"])
+                self.assertEqual(
+                    before["outline"]["name_start"].tolist(),
+                    after["outline"]["name_start"].tolist(),
+                )
+
+    def test_unterminated_def_ends_at_next_def(self):
+        source = b"def F()\n  var x = 1\ndef G()\nenddef\n"
+        parser = Parser(Language(tree_sitter_vim.language()))
+        root = parser.parse(source).root_node
+        self.assertTrue(root.has_error)
+        defs = [child for child in root.children if child.type == "def_function"]
+        self.assertEqual([node.child_by_field_name("name").text for node in defs], [b"F", b"G"])
+        enddef = defs[0].children[-1]
+        self.assertTrue(enddef.is_missing)
+        self.assertEqual(enddef.type, "enddef")
+        self.assertEqual(enddef.start_byte, source.index(b"def G"))
+        self.assertFalse(defs[1].has_error)
+
+    def test_continuation_lines_join_the_statement(self):
+        source = (
+            b"var xs = [1, 2]\n"
+            b"    ->map((_, v) => v * 2)\n"
+            b"    ->filter((_, v) => v > 2)\n"
+            b"var y = 1\n"
+            b"      \\ + 2\n"
+        )
+        parser = Parser(Language(tree_sitter_vim.language()))
+        root = parser.parse(source).root_node
+        self.assertFalse(root.has_error)
+        chains = [child for child in root.children if child.type == "statement_chain"]
+        self.assertEqual([chain.start_point[0] for chain in chains], [0, 3])
+        self.assertEqual([chain.end_point[0] for chain in chains], [2, 4])
+        self.assertEqual(
+            [chain.named_children[0].type for chain in chains],
+            ["let_statement", "let_statement"],
+        )
+
+    def test_changed_lines(self):
+        old = b"vim9script\nvar x = 1\nvar y = 2\nvar z = 3\n"
+        new = b"vim9script\nvar x = 10\nvar y = 2\nvar z = 30\n"
+        edits = [(19, 20, 21), (40, 41, 42)]
+        try:
+            lines = tree_sitter_vim.changed_lines(old, new, edits)
+        except NotImplementedError:
+            self.skipTest("built without the tree-sitter runtime")
+        spans = [tuple(lines[i : i + 4]) for i in range(0, len(lines), 4)]
+        self.assertEqual([span[:3] for span in spans], [(1, 1, 11), (3, 3, 32)])
+        self.assertEqual(new[spans[1][2] : spans[1][3]], b"var z = 30")
+
+    def test_changed_lines_indented(self):
+        # the span starts at the start of the line, indentation included
+        old = b"def F()\n  var y = 2\nenddef\n"
+        new = b"def F()\n  var y = 20\nenddef\n"
+        try:
+            lines = tree_sitter_vim.changed_lines(old, new, [(18, 19, 20)])
+        except NotImplementedError:
+            self.skipTest("built without the tree-sitter runtime")
+        self.assertEqual(tuple(lines[:3]), (1, 1, 8))
+        self.assertEqual(new[lines[2] : lines[3]], b"  var y = 20")
@@ -2,7 +2,7 @@
 
 from importlib.resources import files as _files
 
-from ._binding import language
+from ._binding import changed_lines, language, parse_many
 
 
 def _get_query(name, file):
@@ -12,14 +12,18 @@ def _get_query(name, file):
 
 
 def __getattr__(name):
+    if name == "INJECTIONS_QUERY":
+        return _get_query("INJECTIONS_QUERY", "injections.scm")
+
+    if name == "HIGHLIGHTS_QUERY":
+        return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
+    if name == "LOCALS_QUERY":
+        return _get_query("LOCALS_QUERY", "locals.scm")
+    if name == "FOLDS_QUERY":
+        return _get_query("FOLDS_QUERY", "folds.scm")
+
     # NOTE: uncomment these to include any queries that this grammar contains:
 
-    # if name == "HIGHLIGHTS_QUERY":
-    #     return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
-    # if name == "INJECTIONS_QUERY":
-    #     return _get_query("INJECTIONS_QUERY", "injections.scm")
-    # if name == "LOCALS_QUERY":
-    #     return _get_query("LOCALS_QUERY", "locals.scm")
     # if name == "TAGS_QUERY":
     #     return _get_query("TAGS_QUERY", "tags.scm")
 
@@ -27,10 +31,13 @@ def __getattr__(name):
 
 
 __all__ = [
+    "changed_lines",
     "language",
-    # "HIGHLIGHTS_QUERY",
-    # "INJECTIONS_QUERY",
-    # "LOCALS_QUERY",
+    "parse_many",
+    "INJECTIONS_QUERY",
+    "HIGHLIGHTS_QUERY",
+    "LOCALS_QUERY",
+    "FOLDS_QUERY",
     # "TAGS_QUERY",
 ]
 
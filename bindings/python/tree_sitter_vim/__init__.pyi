@@ -1,10 +1,49 @@
-from typing import Final
+from os import PathLike
+from typing import Final, Sequence, TypedDict
+
+INJECTIONS_QUERY: Final[str]
+HIGHLIGHTS_QUERY: Final[str]
+LOCALS_QUERY: Final[str]
+FOLDS_QUERY: Final[str]
 
 # NOTE: uncomment these to include any queries that this grammar contains:
 
-# HIGHLIGHTS_QUERY: Final[str]
-# INJECTIONS_QUERY: Final[str]
-# LOCALS_QUERY: Final[str]
 # TAGS_QUERY: Final[str]
 
 def language() -> object: ...
+
+class _Outline(TypedDict):
+    # kind: 1 = def, 2 = var, 3 = const; flags bit 0: exported def;
+    # parent: index of the enclosing def or -1; names are byte offsets
+    kind: memoryview
+    flags: memoryview
+    parent: memoryview
+    name_start: memoryview
+    name_end: memoryview
+    start_row: memoryview
+    start_column: memoryview
+    end_row: memoryview
+    end_column: memoryview
+
+class _ParseSummary(TypedDict, total=False):
+    has_error: bool
+    node_count: int
+    byte_length: int
+    cached: bool
+    sexp: str
+    outline: _Outline
+
+def parse_many(
+    sources: Sequence[bytes | str | PathLike[str]],
+    *,
+    threads: int = 0,
+    sexp: bool = False,
+    outline: bool = False,
+    cache: str | PathLike[str] | None = None,
+) -> list[_ParseSummary]: ...
+
+def changed_lines(
+    old_source: bytes,
+    new_source: bytes,
+    edits: Sequence[tuple[int, int, int]],
+) -> memoryview: ...
@@ -1,13 +1,576 @@
 #include <Python.h>
 
-typedef struct TSLanguage TSLanguage;
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
-TSLanguage *tree_sitter_vim(void);
+#include <tree_sitter/tree-sitter-vim9.h>
 
 static PyObject* _binding_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
-    return PyCapsule_New(tree_sitter_vim(), "tree_sitter.Language", NULL);
+    return PyCapsule_New((void *)tree_sitter_vim9(), "tree_sitter.Language", NULL);
 }
 
+#ifdef TREE_SITTER_VIM_PARSE_MANY
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9-changes.h>
+#include <tree_sitter/tree-sitter-vim9-outline.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// One input of parse_many. Paths are read by the worker threads, so file
+// I/O happens without the GIL as well.
+typedef struct {
+    const char *path;
+    const char *data;
+    uint32_t length;
+    char *owned;
+    int error;
+    bool has_error;
+    uint32_t node_count;
+    char *sexp;
+    TreeSitterVim9Outline outline;
+    bool outline_failed;
+    uint64_t hash;
+    bool cached;
+    bool unparsed;  // the runtime couldn't load the language
+} ParseItem;
+
+typedef struct {
+    ParseItem *items;
+    size_t count;
+    bool sexp;
+    bool outline;
+    bool caching;  // a cache file is written afterwards: hash and outline every item
+    const TreeSitterVim9Cache *cache;  // NULL on a cold start even when caching
+#ifdef _WIN32
+    volatile LONG next;
+#else
+    size_t next;
+    pthread_mutex_t lock;
+#endif
+} ParseJob;
+
+static size_t next_item(ParseJob *job) {
+#ifdef _WIN32
+    return (size_t)InterlockedIncrement(&job->next) - 1;
+#else
+    pthread_mutex_lock(&job->lock);
+    size_t index = job->next++;
+    pthread_mutex_unlock(&job->lock);
+    return index;
+#endif
+}
+
+static int read_file(ParseItem *item) {
+    FILE *file = fopen(item->path, "rb");
+    if (!file) {
+        return errno;
+    }
+    int error = 0;
+    long length = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        length = ftell(file);
+    }
+    if (length < 0 || (unsigned long)length > UINT32_MAX || fseek(file, 0, SEEK_SET) != 0) {
+        error = length < 0 ? errno : EFBIG;
+    } else {
+        item->owned = malloc((size_t)length + 1);
+        if (!item->owned) {
+            error = ENOMEM;
+        } else if (fread(item->owned, 1, (size_t)length, file) != (size_t)length) {
+            error = EIO;
+        } else {
+            item->data = item->owned;
+            item->length = (uint32_t)length;
+        }
+    }
+    fclose(file);
+    return error;
+}
+
+// Raised once the GIL is back when a runtime of another ABI range can't load
+// the language.
+static PyObject *language_error(void) {
+    PyErr_Format(PyExc_ValueError,
+                 "tree-sitter-vim9 has language ABI version %u, but the tree-sitter runtime "
+                 "supports %u to %u",
+                 ts_language_abi_version(tree_sitter_vim9()),
+                 (unsigned)TREE_SITTER_MIN_COMPATIBLE_LANGUAGE_VERSION,
+                 (unsigned)TREE_SITTER_LANGUAGE_VERSION);
+    return NULL;
+}
+
+// Each worker owns one TSParser; the language itself is immutable and shared.
+static void parse_worker(ParseJob *job) {
+    TSParser *parser = ts_parser_new();
+    bool loaded = ts_parser_set_language(parser, tree_sitter_vim9());
+    for (size_t i = next_item(job); i < job->count; i = next_item(job)) {
+        ParseItem *item = &job->items[i];
+        if (item->path && (item->error = read_file(item)) != 0) {
+            continue;
+        }
+        // An unchanged file is answered from the cache without parsing.
+        if (job->caching) {
+            item->hash = tree_sitter_vim9_hash(item->data, item->length);
+        }
+        if (job->cache) {
+            TreeSitterVim9CacheInfo info;
+            if (tree_sitter_vim9_cache_get(job->cache, item->hash, item->length, &item->outline,
+                                           &info)) {
+                item->cached = true;
+                item->has_error = info.has_error;
+                item->node_count = info.node_count;
+                free(item->owned);
+                item->owned = NULL;
+                continue;
+            }
+        }
+        TSTree *tree =
+            loaded ? ts_parser_parse_string(parser, NULL, item->data, item->length) : NULL;
+        if (!tree) {
+            item->unparsed = true;
+            free(item->owned);
+            item->owned = NULL;
+            continue;
+        }
+        TSNode root = ts_tree_root_node(tree);
+        item->has_error = ts_node_has_error(root);
+        item->node_count = ts_node_descendant_count(root);
+        if (job->sexp) {
+            item->sexp = ts_node_string(root);
+        }
+        if (job->outline || job->caching) {
+            item->outline_failed = tree_sitter_vim9_outline(tree, &item->outline) == UINT32_MAX;
+        }
+        ts_tree_delete(tree);
+        free(item->owned);
+        item->owned = NULL;
+    }
+    ts_parser_delete(parser);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI parse_thread(LPVOID job) {
+    parse_worker(job);
+    return 0;
+}
+#else
+static void *parse_thread(void *job) {
+    parse_worker(job);
+    return NULL;
+}
+#endif
+
+static size_t cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+static void run_job(ParseJob *job, size_t threads) {
+    if (threads <= 1) {
+        parse_worker(job);
+        return;
+    }
+#ifdef _WIN32
+    HANDLE *handles = calloc(threads, sizeof(HANDLE));
+    size_t started = 0;
+    for (; handles && started < threads; started++) {
+        handles[started] = CreateThread(NULL, 0, parse_thread, job, 0, NULL);
+        if (!handles[started]) {
+            break;
+        }
+    }
+    parse_worker(job);
+    for (size_t i = 0; i < started; i++) {
+        WaitForSingleObject(handles[i], INFINITE);
+        CloseHandle(handles[i]);
+    }
+    free(handles);
+#else
+    pthread_t *handles = calloc(threads, sizeof(pthread_t));
+    size_t started = 0;
+    for (; handles && started < threads; started++) {
+        if (pthread_create(&handles[started], NULL, parse_thread, job) != 0) {
+            break;
+        }
+    }
+    // The calling thread works too, so a failed pthread_create only costs speed.
+    parse_worker(job);
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(handles[i], NULL);
+    }
+    free(handles);
+#endif
+}
+
+// A copy of one outline column as a memoryview of the given struct format.
+static PyObject *outline_column(const void *data, uint32_t count, size_t size,
+                                const char *format) {
+    PyObject *bytes = PyBytes_FromStringAndSize(count ? data : "", (Py_ssize_t)(count * size));
+    PyObject *view = bytes ? PyMemoryView_FromObject(bytes) : NULL;
+    PyObject *column = view ? PyObject_CallMethod(view, "cast", "s", format) : NULL;
+    Py_XDECREF(view);
+    Py_XDECREF(bytes);
+    return column;
+}
+
+static PyObject *outline_dict(const TreeSitterVim9Outline *outline) {
+    const struct {
+        const char *key;
+        const void *data;
+        size_t size;
+        const char *format;
+    } columns[] = {
+        {"kind", outline->kind, sizeof(uint8_t), "B"},
+        {"flags", outline->flags, sizeof(uint8_t), "B"},
+        {"parent", outline->parent, sizeof(int32_t), "i"},
+        {"name_start", outline->name_start, sizeof(uint32_t), "I"},
+        {"name_end", outline->name_end, sizeof(uint32_t), "I"},
+        {"start_row", outline->start_row, sizeof(uint32_t), "I"},
+        {"start_column", outline->start_column, sizeof(uint32_t), "I"},
+        {"end_row", outline->end_row, sizeof(uint32_t), "I"},
+        {"end_column", outline->end_column, sizeof(uint32_t), "I"},
+    };
+    PyObject *dict = PyDict_New();
+    for (size_t i = 0; dict && i < sizeof(columns) / sizeof(columns[0]); i++) {
+        PyObject *column =
+            outline_column(columns[i].data, outline->count, columns[i].size, columns[i].format);
+        if (!column || PyDict_SetItemString(dict, columns[i].key, column) < 0) {
+            Py_CLEAR(dict);
+        }
+        Py_XDECREF(column);
+    }
+    return dict;
+}
+
+static PyObject *item_summary(const ParseItem *item, bool outline) {
+    PyObject *summary = Py_BuildValue("{s:O,s:I,s:I,s:O}", "has_error",
+                                      item->has_error ? Py_True : Py_False, "node_count",
+                                      item->node_count, "byte_length", item->length, "cached",
+                                      item->cached ? Py_True : Py_False);
+    if (summary && item->sexp) {
+        PyObject *sexp = PyUnicode_FromString(item->sexp);
+        if (!sexp || PyDict_SetItemString(summary, "sexp", sexp) < 0) {
+            Py_CLEAR(summary);
+        }
+        Py_XDECREF(sexp);
+    }
+    if (summary && outline) {
+        PyObject *columns = outline_dict(&item->outline);
+        if (!columns || PyDict_SetItemString(summary, "outline", columns) < 0) {
+            Py_CLEAR(summary);
+        }
+        Py_XDECREF(columns);
+    }
+    return summary;
+}
+
+static PyObject *_binding_parse_many(PyObject *Py_UNUSED(self), PyObject *args,
+                                     PyObject *kwargs) {
+    static char *keywords[] = {"sources", "threads", "sexp", "outline", "cache", NULL};
+    PyObject *sources;
+    Py_ssize_t threads = 0;
+    int sexp = 0;
+    int outline = 0;
+    PyObject *cache_path = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$nppO&", keywords, &sources, &threads,
+                                     &sexp, &outline, PyUnicode_FSConverter, &cache_path)) {
+        return NULL;
+    }
+    const char *invalid = cache_path && sexp ? "sexp can't be combined with cache"
+                          : threads < 0      ? "threads must not be negative"
+                                             : NULL;
+    if (invalid) {
+        Py_XDECREF(cache_path);
+        PyErr_SetString(PyExc_ValueError, invalid);
+        return NULL;
+    }
+
+    PyObject *sequence = PySequence_List(sources);
+    if (!sequence) {
+        Py_XDECREF(cache_path);
+        return NULL;
+    }
+    Py_ssize_t count = PyList_Size(sequence);
+
+    // bytes hold the source itself; str and os.PathLike name a file. The
+    // objects stay alive in `keep` while the GIL is released.
+    PyObject *keep = PyList_New(count);
+    ParseJob job = {.items = calloc(count ? (size_t)count : 1, sizeof(ParseItem)),
+                    .count = (size_t)count,
+                    .sexp = sexp,
+                    .outline = outline};
+    PyObject *result = NULL;
+    if (!keep || !job.items) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject *source = PyList_GetItem(sequence, i);
+        ParseItem *item = &job.items[i];
+        char *data;
+        Py_ssize_t length;
+        if (PyBytes_Check(source)) {
+            Py_INCREF(source);
+            PyList_SetItem(keep, i, source);
+            if (PyBytes_AsStringAndSize(source, &data, &length) < 0) {
+                goto done;
+            }
+            if ((size_t)length > UINT32_MAX) {
+                PyErr_SetString(PyExc_ValueError, "source is larger than 4 GiB");
+                goto done;
+            }
+            item->data = data;
+            item->length = (uint32_t)length;
+        } else {
+            PyObject *path = PyOS_FSPath(source);
+            PyObject *encoded = NULL;
+            if (path && PyUnicode_Check(path)) {
+                encoded = PyUnicode_EncodeFSDefault(path);
+            } else if (path) {
+                encoded = path;
+                Py_INCREF(encoded);
+            }
+            Py_XDECREF(path);
+            if (!encoded) {
+                goto done;
+            }
+            PyList_SetItem(keep, i, encoded);
+            if (PyBytes_AsStringAndSize(encoded, &data, &length) < 0) {
+                goto done;
+            }
+            item->path = data;
+        }
+    }
+
+    // A missing, stale or corrupt cache file just means starting cold.
+    TreeSitterVim9Cache *cache = NULL;
+    if (cache_path) {
+        const char *path = PyBytes_AsString(cache_path);
+        Py_BEGIN_ALLOW_THREADS
+        cache = tree_sitter_vim9_cache_open(path);
+        Py_END_ALLOW_THREADS
+    }
+    job.cache = cache;
+    job.caching = cache_path != NULL;
+
+    size_t workers = threads ? (size_t)threads : cpu_count();
+    if (workers > job.count) {
+        workers = job.count;
+    }
+#ifndef _WIN32
+    pthread_mutex_init(&job.lock, NULL);
+#endif
+    Py_BEGIN_ALLOW_THREADS
+    // The calling thread is one of the workers.
+    run_job(&job, workers ? workers - 1 : 0);
+    Py_END_ALLOW_THREADS
+#ifndef _WIN32
+    pthread_mutex_destroy(&job.lock);
+#endif
+    tree_sitter_vim9_cache_close(cache);
+
+    for (size_t i = 0; i < job.count; i++) {
+        if (job.items[i].error) {
+            errno = job.items[i].error;
+            PyErr_SetFromErrnoWithFilename(PyExc_OSError, job.items[i].path);
+            goto done;
+        }
+        if (job.items[i].unparsed) {
+            language_error();
+            goto done;
+        }
+        if (job.items[i].outline_failed) {
+            PyErr_NoMemory();
+            goto done;
+        }
+    }
+    // The new cache holds exactly this call's sources, so files that went
+    // away don't pile up.
+    if (cache_path) {
+        const char *path = PyBytes_AsString(cache_path);
+        TreeSitterVim9CacheWriter *writer = tree_sitter_vim9_cache_writer_new();
+        bool written = writer != NULL;
+        Py_BEGIN_ALLOW_THREADS
+        for (size_t i = 0; written && i < job.count; i++) {
+            ParseItem *item = &job.items[i];
+            TreeSitterVim9CacheInfo info = {item->node_count, item->has_error};
+            written = tree_sitter_vim9_cache_writer_add(writer, item->hash, item->length,
+                                                        &item->outline, &info);
+        }
+        written = written && tree_sitter_vim9_cache_writer_commit(writer, path);
+        tree_sitter_vim9_cache_writer_delete(writer);
+        Py_END_ALLOW_THREADS
+        if (!written) {
+            PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, cache_path);
+            goto done;
+        }
+    }
+    result = PyList_New(count);
+    for (Py_ssize_t i = 0; result && i < count; i++) {
+        PyObject *summary = item_summary(&job.items[i], job.outline);
+        if (!summary) {
+            Py_CLEAR(result);
+            break;
+        }
+        PyList_SetItem(result, i, summary);
+    }
+
+done:
+    for (size_t i = 0; job.items && i < job.count; i++) {
+        free(job.items[i].owned);
+        free(job.items[i].sexp);
+        tree_sitter_vim9_outline_free(&job.items[i].outline);
+    }
+    free(job.items);
+    Py_XDECREF(keep);
+    Py_DECREF(sequence);
+    Py_XDECREF(cache_path);
+    return result;
+}
+
+// `point` moved past data[start, end).
+static TSPoint point_after(TSPoint point, const char *data, uint32_t start, uint32_t end) {
+    for (uint32_t i = start; i < end; i++) {
+        if (data[i] == '\n') {
+            point.row++;
+            point.column = 0;
+        } else {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+// py-tree-sitter owns the trees a Python caller has, so this parses both
+// versions itself: old_source, then new_source incrementally after the edits.
+static PyObject *_binding_changed_lines(PyObject *Py_UNUSED(self), PyObject *args) {
+    const char *old_data, *new_data;
+    Py_ssize_t old_length, new_length;
+    PyObject *edit_list;
+    if (!PyArg_ParseTuple(args, "y#y#O", &old_data, &old_length, &new_data, &new_length,
+                          &edit_list)) {
+        return NULL;
+    }
+    if ((size_t)old_length > UINT32_MAX || (size_t)new_length > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "source is larger than 4 GiB");
+        return NULL;
+    }
+    PyObject *edits = PySequence_List(edit_list);
+    if (!edits) {
+        return NULL;
+    }
+    Py_ssize_t edit_count = PyList_Size(edits);
+    TSInputEdit *input = calloc(edit_count ? (size_t)edit_count : 1, sizeof(TSInputEdit));
+    if (!input) {
+        Py_DECREF(edits);
+        return PyErr_NoMemory();
+    }
+    uint32_t done = 0;
+    int64_t shift = 0;
+    for (Py_ssize_t i = 0; i < edit_count; i++) {
+        TSInputEdit *edit = &input[i];
+        if (!PyArg_ParseTuple(PyList_GetItem(edits, i), "III;edits are (start_byte, "
+                              "old_end_byte, new_end_byte) triples", &edit->start_byte,
+                              &edit->old_end_byte, &edit->new_end_byte)) {
+            free(input);
+            Py_DECREF(edits);
+            return NULL;
+        }
+        int64_t old_start = (int64_t)edit->start_byte - shift;
+        int64_t old_end = (int64_t)edit->old_end_byte - shift;
+        if (edit->start_byte < done || edit->start_byte > edit->old_end_byte ||
+            edit->start_byte > edit->new_end_byte || old_start < 0 || old_end > old_length ||
+            edit->new_end_byte > (uint32_t)new_length) {
+            free(input);
+            Py_DECREF(edits);
+            PyErr_SetString(PyExc_ValueError,
+                            "edits must be in ascending order and inside the sources");
+            return NULL;
+        }
+        done = edit->new_end_byte;
+        shift += (int64_t)edit->new_end_byte - edit->old_end_byte;
+    }
+    Py_DECREF(edits);
+
+    TreeSitterVim9LineSpans spans = {0};
+    uint32_t count = UINT32_MAX;
+    bool loaded = false;
+    Py_BEGIN_ALLOW_THREADS
+    // Edits come in ascending order, each in the coordinates left by the ones
+    // before it, so up to its new end the text is what new_source has; the text
+    // it replaced is in old_source, `shift` bytes earlier.
+    TSPoint point = {0, 0};
+    uint32_t scanned = 0;
+    shift = 0;
+    for (Py_ssize_t i = 0; i < edit_count; i++) {
+        TSInputEdit *edit = &input[i];
+        edit->start_point = point = point_after(point, new_data, scanned, edit->start_byte);
+        edit->old_end_point = point_after(point, old_data, (uint32_t)(edit->start_byte - shift),
+                                          (uint32_t)(edit->old_end_byte - shift));
+        edit->new_end_point = point = point_after(point, new_data, edit->start_byte,
+                                                  edit->new_end_byte);
+        scanned = edit->new_end_byte;
+        shift += (int64_t)edit->new_end_byte - edit->old_end_byte;
+    }
+    TSParser *parser = ts_parser_new();
+    loaded = ts_parser_set_language(parser, tree_sitter_vim9());
+    TSTree *old_tree =
+        loaded ? ts_parser_parse_string(parser, NULL, old_data, (uint32_t)old_length) : NULL;
+    for (Py_ssize_t i = 0; old_tree && i < edit_count; i++) {
+        ts_tree_edit(old_tree, &input[i]);
+    }
+    TSTree *new_tree =
+        old_tree ? ts_parser_parse_string(parser, old_tree, new_data, (uint32_t)new_length) : NULL;
+    if (new_tree) {
+        count = tree_sitter_vim9_changed_lines(old_tree, new_tree, &spans);
+    }
+    ts_tree_delete(new_tree);
+    ts_tree_delete(old_tree);
+    ts_parser_delete(parser);
+    Py_END_ALLOW_THREADS
+    free(input);
+
+    PyObject *result = !loaded             ? language_error()
+                       : count == UINT32_MAX ? PyErr_NoMemory()
+                                             : outline_column(spans.spans, count * 4,
+                                                              sizeof(uint32_t), "I");
+    tree_sitter_vim9_line_spans_free(&spans);
+    return result;
+}
+
+#else
+
+static PyObject *_binding_parse_many(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args),
+                                     PyObject *Py_UNUSED(kwargs)) {
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "parse_many needs the extension to be built against the tree-sitter runtime");
+    return NULL;
+}
+
+static PyObject *_binding_changed_lines(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(args)) {
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "changed_lines needs the extension to be built against the tree-sitter runtime");
+    return NULL;
+}
+
+#endif
+
 static struct PyModuleDef_Slot slots[] = {
 #ifdef Py_GIL_DISABLED
     {Py_mod_gil, Py_MOD_GIL_NOT_USED},
@@ -18,6 +581,25 @@ static struct PyModuleDef_Slot slots[] = {
 static PyMethodDef methods[] = {
     {"language", _binding_language, METH_NOARGS,
      "Get the tree-sitter language for this grammar."},
+    {"parse_many", (PyCFunction)(void (*)(void))_binding_parse_many,
+     METH_VARARGS | METH_KEYWORDS,
+     "parse_many(sources, *, threads=0, sexp=False, outline=False, cache=None)\n--\n\n"
+     "Parse many sources in parallel without holding the GIL.\n\n"
+     "Each source is either bytes (the source itself) or a path. Returns one dict\n"
+     "per source with has_error, node_count and byte_length (and sexp if asked).\n"
+     "outline=True adds the declarations as a dict of memoryviews, one per column\n"
+     "(kind, flags, parent, name_start, name_end, start_row, ...).\n"
+     "cache names an outline cache file: sources whose contents are in it are not\n"
+     "parsed again (their dict has cached=True), and it is rewritten afterwards.\n"
+     "threads=0 uses one thread per CPU."},
+    {"changed_lines", _binding_changed_lines, METH_VARARGS,
+     "changed_lines(old_source, new_source, edits)\n--\n\n"
+     "The lines to re-highlight after editing old_source into new_source.\n\n"
+     "edits are (start_byte, old_end_byte, new_end_byte) triples in the order\n"
+     "Tree.edit() would get them, which must be ascending. Parses old_source, then new_source incrementally, and returns a\n"
+     "flat memoryview of (start_row, end_row, start_byte, end_byte) quadruples:\n"
+     "changed ranges and edits widened to whole statements and merged, with\n"
+     "end_row inclusive."},
     {NULL, NULL, 0, NULL}
 };
 
@@ -0,0 +1,70 @@
+//! `cargo bench --features parallel` over bench/corpus, the same files the C
+//! bench in bench/ uses.
+
+use std::path::Path;
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+
+fn corpus() -> Vec<(String, Vec<u8>)> {
+    let dir = Path::new(env!("CARGO_MANIFEST_DIR")).join("bench/corpus");
+    let mut files: Vec<_> = std::fs::read_dir(&dir)
+        .map(|entries| {
+            entries
+                .filter_map(Result::ok)
+                .map(|entry| entry.path())
+                .filter(|path| path.extension().is_some_and(|ext| ext == "vim"))
+                .map(|path| {
+                    let name = path.file_name().unwrap().to_string_lossy().into_owned();
+                    (name, std::fs::read(&path).unwrap())
+                })
+                .collect()
+        })
+        .unwrap_or_default();
+    files.sort();
+    files
+}
+
+fn parse(c: &mut Criterion) {
+    let files = corpus();
+    if files.is_empty() {
+        eprintln!("bench/corpus is empty, nothing to measure");
+        return;
+    }
+    let total: usize = files.iter().map(|(_, source)| source.len()).sum();
+
+    let mut parser = tree_sitter::Parser::new();
+    parser
+        .set_language(&tree_sitter_vim9::LANGUAGE.into())
+        .expect("Error loading Vim parser");
+
+    let mut group = c.benchmark_group("file");
+    for (name, source) in &files {
+        group.throughput(Throughput::Bytes(source.len() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(name), source, |b, source| {
+            b.iter(|| parser.parse(source, None).unwrap())
+        });
+    }
+    group.finish();
+
+    let mut group = c.benchmark_group("corpus");
+    group.throughput(Throughput::Bytes(total as u64));
+    group.bench_function("sequential", |b| {
+        b.iter(|| {
+            files
+                .iter()
+                .map(|(_, source)| parser.parse(source, None).unwrap())
+                .collect::<Vec<_>>()
+        })
+    });
+    #[cfg(feature = "parallel")]
+    {
+        let sources: Vec<&[u8]> = files.iter().map(|(_, source)| source.as_slice()).collect();
+        group.bench_function("parallel", |b| {
+            b.iter(|| tree_sitter_vim9::parse_parallel(&sources))
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, parse);
+criterion_main!(benches);
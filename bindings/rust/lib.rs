@@ -15,11 +15,19 @@
 //! assert!(!tree.root_node().has_error());
 //! ```
 //!
+//! With the `parallel` feature, [`parse_parallel`] parses many sources at once
+//! on the rayon thread pool.
+//!
 //! [`Parser`]: https://docs.rs/tree-sitter/0.25.10/tree_sitter/struct.Parser.html
 //! [tree-sitter]: https://tree-sitter.github.io/
 
 use tree_sitter_language::LanguageFn;
 
+#[cfg(feature = "parallel")]
+mod parallel;
+#[cfg(feature = "parallel")]
+pub use parallel::parse_parallel;
+
 extern "C" {
     fn tree_sitter_vim9() -> *const ();
 }
@@ -32,11 +40,20 @@ pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_vim9)
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers/6-static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
+/// The injection query for this grammar.
+pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
+
+/// The syntax highlighting query for this grammar.
+pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
+
+/// The local-variable query for this grammar.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
+
+/// The folding query for this grammar.
+pub const FOLDS_QUERY: &str = include_str!("../../queries/folds.scm");
+
 // NOTE: uncomment these to include any queries that this grammar contains:
 
-// pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
-// pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
-// pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
 // pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
 
 #[cfg(test)]
@@ -48,4 +65,28 @@ mod tests {
             .set_language(&super::LANGUAGE.into())
             .expect("Error loading Vim parser");
     }
+
+    #[test]
+    fn test_queries_compile() {
+        let language = super::LANGUAGE.into();
+        for query in [
+            super::HIGHLIGHTS_QUERY,
+            super::LOCALS_QUERY,
+            super::FOLDS_QUERY,
+            super::INJECTIONS_QUERY,
+        ] {
+            tree_sitter::Query::new(&language, query).expect("Error compiling query");
+        }
+    }
+
+    #[cfg(feature = "parallel")]
+    #[test]
+    fn test_parse_parallel() {
+        let sources: [&[u8]; 3] = [b"vim9script\nvar x = 1\n", b"", b"echo 'hi'\n"];
+        let trees = super::parse_parallel(&sources);
+        assert_eq!(trees.len(), sources.len());
+        for (tree, source) in trees.iter().zip(&sources) {
+            assert_eq!(tree.root_node().end_byte(), source.len());
+        }
+    }
 }
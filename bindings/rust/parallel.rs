@@ -0,0 +1,42 @@
+use std::cell::RefCell;
+
+use rayon::prelude::*;
+use tree_sitter::{Parser, Tree};
+
+thread_local! {
+    // One parser per rayon worker, created on first use and kept for the
+    // lifetime of the thread.
+    static PARSER: RefCell<Option<Parser>> = const { RefCell::new(None) };
+}
+
+fn parse_one(source: &[u8]) -> Tree {
+    PARSER.with(|cell| {
+        let mut cell = cell.borrow_mut();
+        let parser = cell.get_or_insert_with(|| {
+            let mut parser = Parser::new();
+            parser
+                .set_language(&crate::LANGUAGE.into())
+                .expect("Error loading Vim parser");
+            parser
+        });
+        // Only a missing language, a timeout or a cancellation flag make parse()
+        // return None, and none of them are set on these parsers.
+        parser.parse(source, None).expect("parse without a timeout failed")
+    })
+}
+
+/// Parses every source on the rayon thread pool and returns the trees in input
+/// order.
+///
+/// Each worker thread keeps its own [`Parser`], so repeated calls don't pay for
+/// parser setup again. Run it inside a custom `rayon::ThreadPool` to bound the
+/// number of threads.
+///
+/// ```
+/// let sources: [&[u8]; 2] = [b"vim9script\n", b"echo 1\n"];
+/// let trees = tree_sitter_vim9::parse_parallel(&sources);
+/// assert_eq!(trees.len(), 2);
+/// ```
+pub fn parse_parallel(sources: &[&[u8]]) -> Vec<Tree> {
+    sources.par_iter().map(|source| parse_one(source)).collect()
+}
@@ -2,34 +2,93 @@
 // Pragmatic Tree-sitter grammar for a Vim9-like .vimrc subset.
 // 增强点：
 // - 行内 | 链式语句
+// - 续行（\ 开头或运算符开头的下一行）并入上一行的语句
 // - 复合赋值 ..=、+=、-=、*=、/=
 // - for 解构变量 [k, v]
 // - 切片索引 expr[ start? : end? ]（可与索引链式）
 // - 顶层同时支持“结构化语句块”（def/if/for）和“可链语句行”
 // - command 简化为：name + repeat(safe_arg) + optional(raw_text)
+// - 命令名由外部扫描器（src/scanner.c）按 keywords.h 一次识别，支持缩写
+
+const { keywords, names: KEYWORD_NAMES } = require('./keywords');
+
+// 语法里单独处理的关键字，不作为普通命令名
+const BLOCK_KEYWORDS = [
+  'vim9script', 'export', 'def', 'enddef', 'var', 'const',
+  'if', 'elseif', 'else', 'endif', 'for', 'endfor',
+  'default', // 只是 highlight 的子关键字
+];
+
+// 参数不是表达式的命令：参数整段作为一个 raw_text，不走表达式语法；
+// 需要内部结构时由 queries/injections.scm 按需再解析
+const RAW_ARGUMENT_COMMANDS = [
+  'map', 'nmap', 'vmap', 'xmap', 'smap', 'omap', 'imap', 'lmap', 'cmap', 'tmap',
+  'noremap', 'nnoremap', 'vnoremap', 'xnoremap', 'snoremap',
+  'onoremap', 'inoremap', 'lnoremap', 'cnoremap', 'tnoremap',
+  'highlight', 'syntax', 'autocmd',
+];
+
+// 内嵌脚本命令：lua << [trim] EOF ... EOF 整段是一个 heredoc，
+// 单行形式（lua print(1)）同上面一样是一整段 raw_text
+const SCRIPT_COMMANDS = ['lua', 'perl', 'ruby', 'python', 'py3', 'python3'];
+
+// 外部扫描器给出的关键字 token，alias 成全名（fu / func / function 都是 "function"）
+const keyword = ($, name) => alias($['_' + name], name);
 
 module.exports = grammar({
   name: 'vim9',
 
+  // 关键字提取：先按标识符词法扫出整个单词，再由 ts_lex_keywords 判断是不是
+  // 'in'、类型名、true/false 等字面关键字。块关键字和命令名由外部扫描器给出，不受影响
+  word: $ => $._name,
+
+  // 前面的顺序与 keywords.h 的 kwid 一致（最后一个是 unknown_command_name），
+  // 之后是扫描器向前看判定的括号和整段扫描的长 token，顺序与 scanner.c 一致
+  externals: $ => [
+    ...keywords($),
+    $._lambda_open,
+    $._block_open,
+    $.string,
+    $.comment,
+    $._raw_arguments,
+    $.heredoc_start,
+    $.heredoc_body,
+    $.heredoc_end,
+    $._line_continuation,
+    $._error_sentinel, // 不出现在规则里；为 true 说明处于错误恢复
+  ],
+
   extras: $ => [
     /[ \t\r\f]/,
-    // 不把续行放到 extras
+    // 下一行以 \ 或 -> .. + && || 开头（? 和 : 后面还要有空白）时，扫描器把换行
+    // 连同缩进（和 \）当空白，多行表达式仍是同一条语句
+    $._line_continuation,
   ],
 
-  conflicts: $ => [
-    [$.command, $.assignment],
-    [$.command, $.let_statement],
-    [$.command, $.expr_statement],
-    [$.parameter, $.expr],
-    [$.parenthesized_expression, $.arrow_function],
-    [$.arguments, $.parameter],
-    [$.block, $.dict],
+  // lambda 的 ( 和代码块的 { 由扫描器向前看决定，不需要 GLR
+  conflicts: $ => [],
+
+  // 这些规则只是分类，不产生包裹节点；查询里仍可写 (_expression)
+  supertypes: $ => [
+    $._expression,
+    $._chainable_statement,
+    $._structured_statement,
+    $._safe_arg,
   ],
 
   rules: {
     // ========== 行级与顶层组织 ==========
+    // 顶层：结构化块 或 行（含链式）；续行由扫描器并进同一行，必须是第一条规则
+    source_file: $ => seq(
+      repeat(choice(
+        $._structured_statement,
+        seq(optional($.statement_chain), $.newline)
+      )),
+      optional($.statement_chain)
+    ),
+
     // 可链式语句（同一行可用 | 连接多条）
-    chainable_statement: $ => choice(
+    _chainable_statement: $ => choice(
       $.comment,
       $.vim9script,
       $.command,
@@ -42,34 +101,19 @@ module.exports = grammar({
 
     // 用单个 | 分隔
     statement_chain: $ => seq(
-      $.chainable_statement,
-      repeat(seq('|', $.chainable_statement))
+      $._chainable_statement,
+      repeat(seq('|', $._chainable_statement))
     ),
 
     // 结构化语句块（自身处理多行）
-    structured_statement: $ => choice(
+    _structured_statement: $ => choice(
       $.def_function,
       $.if_statement,
       $.for_statement
     ),
 
-    // 顶层：结构化块 或 行（含链式 + 续行）
-    source_file: $ => seq(
-      repeat(choice(
-        $.structured_statement,
-        seq(optional($.statement_chain), repeat($.continued_line), $.newline)
-      )),
-      optional(seq(
-        optional($.statement_chain),
-        repeat($.continued_line)
-      ))
-    ),
-
     newline: $ => /\n/,
 
-    // 续行：行首空白 + \ + 非换行若干 + 换行
-    continued_line: $ => seq(/[ \t]*\\[^\n]*/, $.newline),
-
     // 备用（块内也会用到的“单条语句”入口）
     _statement: $ => choice(
       $.comment,
@@ -86,9 +130,10 @@ module.exports = grammar({
     ),
 
     // ========== 基础元素 ==========
-    vim9script: $ => 'vim9script',
+    vim9script: $ => keyword($, 'vim9script'),
 
-    comment: $ => seq('#', /[^\n]*/),
+    // comment（# 到行尾）、string（不跨行）和映射等命令的参数
+    // 由外部扫描器一次扫到终止符，见 externals
 
     // 特殊键 <CR> 等
     special_key: $ => token(seq('<', /[^>\n]+/, '>')),
@@ -97,17 +142,55 @@ module.exports = grammar({
     raw_text: $ => token(prec(-1, /[^|\n]+/)),
 
     // ========== 命令（Ex） ==========
-    // 统一简化：name + 0+ safe_arg + 可选 raw_text
-    command: $ => seq(
-      $.command_name,
-      repeat($.safe_arg),
-      optional($.raw_text)
+    // 统一简化：name + 0+ safe_arg + 可选 raw_text；
+    // 映射等命令：name + 一整段 raw_text
+    command: $ => choice(
+      seq(
+        field('name', $.command_name),
+        repeat($._safe_arg),
+        optional($.raw_text)
+      ),
+      seq(
+        field('name', alias($._raw_command_name, $.command_name)),
+        optional(field('arguments', alias($._raw_arguments, $.raw_text)))
+      ),
+      seq(
+        field('name', alias($._script_command_name, $.command_name)),
+        choice(
+          field('heredoc', $.heredoc),
+          optional(field('arguments', alias($._raw_arguments, $.raw_text)))
+        )
+      )
     ),
 
-    command_name: $ => token(prec(1, /[A-Za-z][A-Za-z0-9_-]+!?/)),
+    // 已知命令是带全名的匿名子节点，其余为 unknown_command_name
+    command_name: $ => choice(
+      ...KEYWORD_NAMES
+        .filter(name => !BLOCK_KEYWORDS.includes(name))
+        .filter(name => !RAW_ARGUMENT_COMMANDS.includes(name))
+        .filter(name => !SCRIPT_COMMANDS.includes(name))
+        .map(name => keyword($, name)),
+      $.unknown_command_name
+    ),
+
+    _raw_command_name: $ => choice(
+      ...RAW_ARGUMENT_COMMANDS.map(name => keyword($, name))
+    ),
+
+    _script_command_name: $ => choice(
+      ...SCRIPT_COMMANDS.map(name => keyword($, name))
+    ),
+
+    // heredoc_start 是 "<< [trim] EOF" 连同换行，heredoc_end 是结束标记本身；
+    // 结束标记由扫描器记在状态里
+    heredoc: $ => seq(
+      $.heredoc_start,
+      optional(field('body', $.heredoc_body)),
+      $.heredoc_end
+    ),
 
     // 安全参数：避免把 '|' 当作参数
-    safe_arg: $ => choice(
+    _safe_arg: $ => choice(
       $.string,
       $.number,
       $.float,
@@ -122,29 +205,33 @@ module.exports = grammar({
 
     // ========== 变量与赋值 ==========
     const_statement: $ => prec(2, seq(
-      'const',
-      $.identifier,
-      optional(seq(':', $.type)),
+      keyword($, 'const'),
+      field('name', $.identifier),
+      optional(seq(':', field('type', $.type))),
       '=',
-      $.expr
+      field('value', $._expression)
     )),
 
     let_statement: $ => prec(2, seq(
-      'var',
-      $.identifier,
-      optional(seq(':', $.type)),
+      keyword($, 'var'),
+      field('name', $.identifier),
+      optional(seq(':', field('type', $.type))),
       '=',
-      $.expr
+      field('value', $._expression)
     )),
 
     // 普通赋值
-    assignment: $ => prec(2, seq($.lvalue, '=', $.expr)),
+    assignment: $ => prec(2, seq(
+      field('left', $.lvalue),
+      field('operator', '='),
+      field('right', $._expression)
+    )),
 
     // 复合赋值
     augmented_assignment: $ => prec(2, seq(
-      $.lvalue,
-      choice('..=', '+=', '-=', '*=', '/='),
-      $.expr
+      field('left', $.lvalue),
+      field('operator', choice('..=', '+=', '-=', '*=', '/=')),
+      field('right', $._expression)
     )),
 
     lvalue: $ => choice(
@@ -160,12 +247,12 @@ module.exports = grammar({
     // ========== 表达式 ==========
     // 索引/切片，可链式：a[1][ : 3]
     index_expression: $ => prec.left(10, seq(
-      $.expr,
+      field('object', $._expression),
       repeat1(choice(
         // 索引
-        seq('[', $.expr, ']'),
+        seq('[', $._expression, ']'),
         // 切片 [start? : end?]
-        seq('[', optional($.expr), ':', optional($.expr), ']')
+        seq('[', optional($._expression), ':', optional($._expression), ']')
       ))
     )),
 
@@ -179,45 +266,54 @@ module.exports = grammar({
     function_name: $ => alias($._name, $.function_name),
 
     call_expression: $ => seq(
-      $.function_name,
+      field('function', $.function_name),
       token.immediate('('),
-      optional($.arguments),
+      optional(field('arguments', $.arguments)),
       ')'
     ),
 
-    arguments: $ => seq($.expr, repeat(seq(',', $.expr))),
+    arguments: $ => seq($._expression, repeat(seq(',', $._expression))),
 
+    // ( ... ) => 的 ( 由扫描器匹配到配对的 ) 并看到 => 才给出
     arrow_function: $ => prec.right(2, seq(
-      '(',
-      optional(seq($.parameter, repeat(seq(',', $.parameter)))),
-      ')',
+      field('parameters', alias($._lambda_parameters, $.parameters)),
       '=>',
-      choice($.expr, $.block)
+      field('body', choice($._expression, $.block))
     )),
 
-    // 代码块：每行允许链式语句
+    _lambda_parameters: $ => seq(
+      alias($._lambda_open, '('),
+      optional(seq($.parameter, repeat(seq(',', $.parameter)))),
+      ')'
+    ),
+
+    // 代码块：每行允许链式语句；=> 之后 { 紧跟换行才是代码块，否则是 dict
     block: $ => seq(
-      '{',
-      repeat(choice(
-        $.newline,
-        seq(optional($.statement_chain), $.newline)
-      )),
+      alias($._block_open, '{'),
+      repeat(seq(optional($.statement_chain), $.newline)),
       '}'
     ),
 
     def_function: $ => seq(
-      optional('export'),
-      'def',
-      $.identifier,
+      optional(keyword($, 'export')),
+      keyword($, 'def'),
+      field('name', $.identifier),
+      field('parameters', $.parameters),
+      optional(seq(':', field('return_type', $.type))),
+      repeat(seq(optional(field('body', $.statement_chain)), $.newline)),
+      keyword($, 'enddef')
+    ),
+
+    parameters: $ => seq(
       '(',
       optional(seq($.parameter, repeat(seq(',', $.parameter)))),
-      ')',
-      optional(seq(':', $.type)),
-      repeat(seq(optional($.statement_chain), $.newline)),
-      'enddef'
+      ')'
     ),
 
-    parameter: $ => seq($.identifier, optional(seq(':', $.type))),
+    parameter: $ => seq(
+      field('name', $.identifier),
+      optional(seq(':', field('type', $.type)))
+    ),
 
     type: $ => choice(
       'bool', 'number', 'float', 'string', 'any',
@@ -226,7 +322,7 @@ module.exports = grammar({
       $.identifier
     ),
 
-    expr: $ => choice(
+    _expression: $ => choice(
       $.string,
       $.number,
       $.float,
@@ -248,7 +344,7 @@ module.exports = grammar({
 
     parenthesized_expression: $ => seq(
       '(',
-      optional($.expr),
+      optional($._expression),
       ')'
     ),
 
@@ -256,12 +352,12 @@ module.exports = grammar({
       '[',
       optional(seq(
         repeat($.newline),
-        $.expr,
+        $._expression,
         repeat(seq(
           repeat($.newline),
           ',',
           repeat($.newline),
-          $.expr
+          $._expression
         )),
         optional(seq(repeat($.newline), ','))
       )),
@@ -269,7 +365,7 @@ module.exports = grammar({
       ']'
     )),
 
-    pair: $ => seq($.dict_key, ':', $.expr),
+    pair: $ => seq(field('key', $.dict_key), ':', field('value', $._expression)),
     dict_key: $ => choice($.identifier, $.string),
 
     dict: $ => seq(
@@ -293,74 +389,64 @@ module.exports = grammar({
     float: $ => token(/[0-9]+\.[0-9]+/),
     boolean: $ => token(choice('true', 'false')),
 
-    string: $ => token(choice(
-      /"(?:[^"\\]|\\.)*"/,
-      /'(?:[^'\\]|\\.)*'/
-    )),
-
-    unary_expression: $ => prec(7, choice(
-      seq('!', $.expr),
-      seq('-', $.expr)
+    unary_expression: $ => prec(7, seq(
+      field('operator', choice('!', '-')),
+      field('argument', $._expression)
     )),
 
     method_call: $ => prec.left(9, seq(
-      $.expr,
+      field('object', $._expression),
       '->',
-      $.identifier,
+      field('name', $.identifier),
       '(',
-      optional($.arguments),
+      optional(field('arguments', $.arguments)),
       ')'
     )),
 
-    binary_expression: $ => choice(
+    binary_expression: $ => choice(...[
       // String concat
-      prec.left(3, seq($.expr, '..', $.expr)),
+      ['..', 3],
       // Arithmetic
-      prec.left(5, seq($.expr, '+', $.expr)),
-      prec.left(5, seq($.expr, '-', $.expr)),
-      prec.left(6, seq($.expr, '*', $.expr)),
-      prec.left(6, seq($.expr, '/', $.expr)),
+      ['+', 5], ['-', 5], ['*', 6], ['/', 6],
       // Comparisons
-      prec.left(4, seq($.expr, '==',  $.expr)),
-      prec.left(4, seq($.expr, '!=',  $.expr)),
-      prec.left(4, seq($.expr, '==#', $.expr)),
-      prec.left(4, seq($.expr, '!=#', $.expr)),
-      prec.left(4, seq($.expr, '==?', $.expr)),
-      prec.left(4, seq($.expr, '!=?', $.expr)),
-      prec.left(4, seq($.expr, '=~',  $.expr)),
-      prec.left(4, seq($.expr, '!~',  $.expr)),
-      prec.left(4, seq($.expr, '=~#', $.expr)),
-      prec.left(4, seq($.expr, '!~#', $.expr)),
-      prec.left(4, seq($.expr, '>=',  $.expr)),
-      prec.left(4, seq($.expr, '<=',  $.expr)),
-      prec.left(4, seq($.expr, '>',   $.expr)),
-      prec.left(4, seq($.expr, '<',   $.expr)),
+      ['==', 4], ['!=', 4], ['==#', 4], ['!=#', 4], ['==?', 4], ['!=?', 4],
+      ['=~', 4], ['!~', 4], ['=~#', 4], ['!~#', 4],
+      ['>=', 4], ['<=', 4], ['>', 4], ['<', 4],
       // Logical
-      prec.left(2, seq($.expr, '&&', $.expr)),
-      prec.left(1, seq($.expr, '||', $.expr))
-    ),
-
-    ternary_expression: $ => prec.right(0, seq($.expr, '?', $.expr, ':', $.expr)),
+      ['&&', 2], ['||', 1],
+    ].map(([operator, precedence]) => prec.left(precedence, seq(
+      field('left', $._expression),
+      field('operator', operator),
+      field('right', $._expression)
+    )))),
+
+    ternary_expression: $ => prec.right(0, seq(
+      field('condition', $._expression),
+      '?',
+      field('consequence', $._expression),
+      ':',
+      field('alternative', $._expression)
+    )),
 
     // ========== 控制结构 ==========
     if_statement: $ => seq(
-      'if',
-      $.expr,
-      repeat(seq(optional($.statement_chain), $.newline)),
-      repeat($.elseif_clause),
-      optional($.else_clause),
-      'endif'
+      keyword($, 'if'),
+      field('condition', $._expression),
+      repeat(seq(optional(field('consequence', $.statement_chain)), $.newline)),
+      repeat(field('alternative', $.elseif_clause)),
+      optional(field('alternative', $.else_clause)),
+      keyword($, 'endif')
     ),
 
     elseif_clause: $ => seq(
-      'elseif',
-      $.expr,
-      repeat(seq(optional($.statement_chain), $.newline))
+      keyword($, 'elseif'),
+      field('condition', $._expression),
+      repeat(seq(optional(field('consequence', $.statement_chain)), $.newline))
     ),
 
     else_clause: $ => seq(
-      'else',
-      repeat(seq(optional($.statement_chain), $.newline))
+      keyword($, 'else'),
+      repeat(seq(optional(field('body', $.statement_chain)), $.newline))
     ),
 
     // for 支持解构变量 [k, v]
@@ -372,12 +458,12 @@ module.exports = grammar({
     ),
 
     for_statement: $ => seq(
-      'for',
-      choice($.identifier, $.list_pattern),
+      keyword($, 'for'),
+      field('iterator', choice($.identifier, $.list_pattern)),
       'in',
-      $.expr,
-      repeat(seq(optional($.statement_chain), $.newline)),
-      'endfor'
+      field('iterable', $._expression),
+      repeat(seq(optional(field('body', $.statement_chain)), $.newline)),
+      keyword($, 'endfor')
     ),
   }
 });
@@ -498,8 +498,62 @@ const KEYWORDS = {
     opt: "",
     ignore_comments_after: false,
   },
+  EXPORT: {
+    mandat: "export",
+    opt: "",
+    ignore_comments_after: false,
+  },
+
+  // -----------------------------
+  // :py3 / :python3 不是前缀缩写关系，分成两条
+  // -----------------------------
+  PY3: {
+    mandat: "py3",
+    opt: "",
+    ignore_comments_after: false,
+  },
+  PYTHON3: {
+    mandat: "python3",
+    opt: "",
+    ignore_comments_after: false,
+  },
 };
 
+// 所有合法缩写的字典树，按状态展开成平铺的 uint16_t 表。
+// 第 0 列是该状态接受的 kwid（不接受为 UNKNOWN_COMMAND），
+// 其余列按字符类跳转，0 表示没有后继（根状态不会被跳回）。
+function make_trie() {
+  const entries = Object.entries(KEYWORDS);
+  const unknown = entries.length;
+
+  const chars = [...new Set(entries.flatMap(([, k]) => [...(k.mandat + k.opt)]))].sort();
+  const char_class = new Map(chars.map((c, i) => [c, i + 1]));
+
+  const states = [{ accept: unknown, full: false, next: new Map() }];
+  entries.forEach(([, infos], id) => {
+    const name = infos.mandat + infos.opt;
+    let state = 0;
+    for (let i = 0; i < name.length; i++) {
+      const c = char_class.get(name[i]);
+      if (!states[state].next.has(c)) {
+        states[state].next.set(c, states.length);
+        states.push({ accept: unknown, full: false, next: new Map() });
+      }
+      state = states[state].next.get(c);
+      if (i + 1 < infos.mandat.length) continue;
+      // 全名优先于别人的缩写（"def" 是 DEF 而不是 DEFAULT），否则先到先得
+      const full = i + 1 === name.length;
+      const s = states[state];
+      if (s.accept === unknown || (full && !s.full)) {
+        s.accept = id;
+        s.full = full;
+      }
+    }
+  });
+
+  return { chars, char_class, states };
+}
+
 function make_keywords($) {
   const fs = require("fs");
   const path = require("path");
@@ -528,7 +582,7 @@ function make_keywords($) {
     `  UNKNOWN_COMMAND
 } kwid;
 
-keyword keywords[] = {
+static const keyword keywords[] = {
 `,
     (err) => {}
   );
@@ -546,11 +600,56 @@ keyword keywords[] = {
     );
   }
 
+  fs.appendFileSync(KEYWORDS_FILE, "};\n", (err) => {});
+
+  const { chars, char_class, states } = make_trie();
+  const class_count = chars.length + 1;
+
+  let class_table = new Array(128).fill(0);
+  for (const [c, i] of char_class) class_table[c.charCodeAt(0)] = i;
+
+  fs.appendFileSync(
+    KEYWORDS_FILE,
+    `
+#define KEYWORD_TRIE_STATE_COUNT ${states.length}
+#define KEYWORD_TRIE_CLASS_COUNT ${class_count}
+
+// 字符类 1..${chars.length}: ${chars.join("")}
+static const uint8_t keyword_char_class[128] = {
+${chunk(class_table, 16).map((row) => "  " + row.join(", ") + ",").join("\n")}
+};
+
+static const uint16_t keyword_trie[KEYWORD_TRIE_STATE_COUNT][KEYWORD_TRIE_CLASS_COUNT] = {
+`,
+    (err) => {}
+  );
+
+  const unknown = Object.keys(KEYWORDS).length;
+  states.forEach((state, i) => {
+    let row = new Array(class_count).fill(0);
+    row[0] = state.accept;
+    for (const [c, next] of state.next) row[c] = next;
+    const accept = state.accept === unknown ? "UNKNOWN_COMMAND" : Object.keys(KEYWORDS)[state.accept];
+    fs.appendFileSync(
+      KEYWORDS_FILE,
+      `  [${i}] = {${accept}, ${row.slice(1).join(", ")}},\n`,
+      (err) => {}
+    );
+  });
+
   fs.appendFileSync(KEYWORDS_FILE, "};", (err) => {});
 
   return rules;
 }
 
+function chunk(array, size) {
+  let rows = [];
+  for (let i = 0; i < array.length; i += size) rows.push(array.slice(i, i + size));
+  return rows;
+}
+
 module.exports = {
   keywords: make_keywords,
+  // 按 kwid 顺序的命令全名
+  names: Object.values(KEYWORDS).map((infos) => infos.mandat + infos.opt),
 };
@@ -0,0 +1,7 @@
+; 多行结构；单行的由编辑器自己忽略
+
+[
+  (block)
+  (dict)
+  (list)
+] @fold
@@ -0,0 +1,113 @@
+; 只按节点类型和字面 token 匹配，不用 #match? 之类的正则谓词：
+; 类型在编译查询时就变成 symbol id 的比较，正则要对每个候选节点的文本跑一遍。
+; 现在的 src/parser.c 还没有字段，也没有 def/if/for、heredoc 这些节点，
+; 这里只写它编得过的部分，语法重新生成后再补上。
+; 同一节点命中多条时前面的优先，所以具体的写在前面，(identifier) 放在最后。
+
+(comment) @comment
+
+(string) @string
+(special_key) @string.special
+
+(number) @number
+(float) @number.float
+(boolean) @boolean
+
+; ---------- 关键字 ----------
+
+(vim9script) @keyword.directive
+
+[
+  "var"
+  "const"
+] @keyword
+
+(command_name) @keyword
+
+; ---------- 定义与调用 ----------
+
+(call_expression
+  (function_name) @function.call)
+
+; method_call 直接的 identifier 子节点就是方法名，接收者在 expr 里
+(method_call
+  (identifier) @function.method.call)
+
+(parameter
+  (identifier) @variable.parameter)
+
+(const_statement
+  (identifier) @constant)
+
+[
+  "bool"
+  "number"
+  "float"
+  "string"
+  "any"
+  "list"
+  "dict"
+] @type.builtin
+(type
+  (identifier) @type)
+
+(dict_key
+  (identifier) @property)
+
+(scope_var) @variable
+(option_var) @variable.builtin
+
+; ---------- 运算符与标点 ----------
+
+[
+  "="
+  "+="
+  "-="
+  "*="
+  "/="
+  "..="
+  "+"
+  "-"
+  "*"
+  "/"
+  ".."
+  "!"
+  "&&"
+  "||"
+  "=="
+  "==#"
+  "==?"
+  "!="
+  "!=#"
+  "!=?"
+  "=~"
+  "=~#"
+  "!~"
+  "!~#"
+  "<"
+  "<="
+  ">"
+  ">="
+  "=>"
+  "->"
+  "?"
+] @operator
+
+[
+  "("
+  ")"
+  "["
+  "]"
+  "{"
+  "}"
+  "#"
+] @punctuation.bracket
+
+[
+  ","
+  ":"
+] @punctuation.delimiter
+
+"|" @punctuation.special
+
+(identifier) @variable
@@ -0,0 +1,38 @@
+; 映射和 autocmd 的参数在语法树里是一整段 raw_text，其中带有 Ex 命令，
+; 编辑器需要内部结构时再把这段文本按 vim 重新解析（只解析可见部分即可）。
+; 现在的 src/parser.c 里 command_name 是单个叶子，看不出是哪条命令，
+; 只能用 #any-of? 比较命令名（整串相等，不是正则）；heredoc 要等语法重新生成。
+
+(command
+  (command_name) @_name
+  (raw_text) @injection.content
+  (#any-of? @_name
+    "map" "nmap" "vmap" "xmap" "smap" "omap" "imap" "lmap" "cmap" "tmap"
+    "noremap" "nnoremap" "vnoremap" "xnoremap" "snoremap"
+    "onoremap" "inoremap" "lnoremap" "cnoremap" "tnoremap"
+    "autocmd")
+  (#set! injection.language "vim"))
+
+(command
+  (command_name) @_name
+  (raw_text) @injection.content
+  (#eq? @_name "lua")
+  (#set! injection.language "lua"))
+
+(command
+  (command_name) @_name
+  (raw_text) @injection.content
+  (#any-of? @_name "python" "py3" "python3")
+  (#set! injection.language "python"))
+
+(command
+  (command_name) @_name
+  (raw_text) @injection.content
+  (#eq? @_name "perl")
+  (#set! injection.language "perl"))
+
+(command
+  (command_name) @_name
+  (raw_text) @injection.content
+  (#eq? @_name "ruby")
+  (#set! injection.language "ruby"))
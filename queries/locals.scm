@@ -0,0 +1,18 @@
+; Vim9 的变量是块作用域。现在的 src/parser.c 里只有 block 和 lambda 两种作用域节点，
+; 也没有字段，def/if/for 的作用域等语法重新生成后再加。
+
+[
+  (arrow_function)
+  (block)
+] @local.scope
+
+(parameter
+  (identifier) @local.definition.parameter)
+
+(let_statement
+  (identifier) @local.definition.var)
+
+(const_statement
+  (identifier) @local.definition.constant)
+
+(identifier) @local.reference
@@ -1,3 +1,5 @@
+import shlex
+import subprocess
 from os import path
 from sysconfig import get_config_var
 
@@ -8,6 +10,20 @@ from setuptools.command.egg_info import egg_info
 from wheel.bdist_wheel import bdist_wheel
 
 
+def tree_sitter_runtime():
+    """pkg-config flags for the tree-sitter runtime, or None if it is not installed."""
+    try:
+        cflags, libs = (
+            subprocess.run(
+                ["pkg-config", flag, "tree-sitter"], check=True, capture_output=True, text=True
+            ).stdout
+            for flag in ("--cflags", "--libs")
+        )
+    except (OSError, subprocess.CalledProcessError):
+        return None
+    return shlex.split(cflags), shlex.split(libs)
+
+
 class Build(build):
     def run(self):
         if path.isdir("queries"):
@@ -26,6 +42,14 @@ class BuildExt(build_ext):
             ext.sources.append("src/scanner.c")
         if ext.py_limited_api:
             ext.define_macros.append(("Py_LIMITED_API", "0x030A0000"))
+        # parse_many drives TSParser itself, so it needs the runtime library
+        runtime = tree_sitter_runtime()
+        if runtime is not None:
+            cflags, libs = runtime
+            ext.define_macros.append(("TREE_SITTER_VIM_PARSE_MANY", None))
+            ext.sources.append("bindings/c/cache.c")
+            ext.extra_compile_args += cflags
+            ext.extra_link_args += libs
         super().build_extension(ext)
 
 
@@ -42,6 +66,7 @@ class EggInfo(egg_info):
         super().find_sources()
         self.filelist.recursive_include("queries", "*.scm")
         self.filelist.include("src/tree_sitter/*.h")
+        self.filelist.include("bindings/c/tree_sitter/*.h")
 
 
 setup(
@@ -63,7 +88,7 @@ setup(
                 ("PY_SSIZE_T_CLEAN", None),
                 ("TREE_SITTER_HIDE_SYMBOLS", None),
             ],
-            include_dirs=["src"],
+            include_dirs=["src", "bindings/c"],
             py_limited_api=not get_config_var("Py_GIL_DISABLED"),
         )
     ],
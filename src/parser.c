@@ -2,6 +2,14 @@
 
 #include "tree_sitter/parser.h"
 
+// vim9-lexmap: lookup in a dense table, entries hold state + 1
+#ifndef ADVANCE_TABLE
+#define ADVANCE_TABLE(map)                           \
+  {                                                  \
+    if (map[lookahead]) ADVANCE(map[lookahead] - 1); \
+  }
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
 #endif
@@ -1114,45 +1122,49 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   switch (state) {
     case 0:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 166,
-        '"', 5,
-        '#', 35,
-        '&', 7,
-        '\'', 8,
-        '(', 144,
-        ')', 145,
-        '*', 177,
-        '+', 175,
-        ',', 146,
-        '-', 169,
-        '.', 9,
-        '/', 179,
-        ':', 83,
-        '<', 157,
-        '=', 85,
-        '>', 159,
-        '?', 194,
-        '[', 94,
-        ']', 95,
-        '_', 141,
-        'a', 105,
-        'b', 98,
-        'c', 106,
-        'd', 104,
-        'f', 102,
-        'l', 97,
-        'n', 107,
-        's', 100,
-        't', 99,
-        'v', 96,
-        '{', 149,
-        '|', 33,
-        '}', 150,
-        'g', 101,
-        'w', 101,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 167,
+          ['"'] = 6,
+          ['#'] = 36,
+          ['&'] = 8,
+          ['\''] = 9,
+          ['('] = 145,
+          [')'] = 146,
+          ['*'] = 178,
+          ['+'] = 176,
+          [','] = 147,
+          ['-'] = 170,
+          ['.'] = 10,
+          ['/'] = 180,
+          [':'] = 84,
+          ['<'] = 158,
+          ['='] = 86,
+          ['>'] = 160,
+          ['?'] = 195,
+          ['['] = 95,
+          [']'] = 96,
+          ['_'] = 142,
+          ['a'] = 106,
+          ['b'] = 99,
+          ['c'] = 107,
+          ['d'] = 105,
+          ['f'] = 103,
+          ['g'] = 102,
+          ['l'] = 98,
+          ['n'] = 108,
+          ['s'] = 101,
+          ['t'] = 100,
+          ['v'] = 97,
+          ['w'] = 102,
+          ['{'] = 150,
+          ['|'] = 34,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1162,33 +1174,37 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
           ('e' <= lookahead && lookahead <= 'z')) ADVANCE(108);
       END_STATE();
     case 1:
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 165,
-        '"', 5,
-        '#', 35,
-        '&', 22,
-        '\'', 8,
-        '(', 147,
-        ')', 145,
-        '*', 13,
-        '+', 14,
-        ',', 146,
-        '-', 168,
-        '.', 11,
-        '/', 15,
-        ':', 83,
-        '=', 84,
-        '>', 158,
-        '[', 94,
-        '_', 141,
-        'c', 106,
-        'f', 103,
-        't', 99,
-        'v', 96,
-        '{', 149,
-        '}', 150,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 166,
+          ['"'] = 6,
+          ['#'] = 36,
+          ['&'] = 23,
+          ['\''] = 9,
+          ['('] = 148,
+          [')'] = 146,
+          ['*'] = 14,
+          ['+'] = 15,
+          [','] = 147,
+          ['-'] = 169,
+          ['.'] = 12,
+          ['/'] = 16,
+          [':'] = 84,
+          ['='] = 85,
+          ['>'] = 159,
+          ['['] = 95,
+          ['_'] = 142,
+          ['c'] = 107,
+          ['f'] = 104,
+          ['t'] = 100,
+          ['v'] = 97,
+          ['{'] = 150,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1203,24 +1219,28 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
           ('a' <= lookahead && lookahead <= 'z')) ADVANCE(108);
       END_STATE();
     case 2:
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 165,
-        '"', 5,
-        '&', 22,
-        '\'', 8,
-        '(', 147,
-        ')', 145,
-        ',', 146,
-        '-', 167,
-        ':', 83,
-        '[', 94,
-        ']', 95,
-        'f', 111,
-        't', 109,
-        '{', 149,
-        '}', 150,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 166,
+          ['"'] = 6,
+          ['&'] = 23,
+          ['\''] = 9,
+          ['('] = 148,
+          [')'] = 146,
+          [','] = 147,
+          ['-'] = 168,
+          [':'] = 84,
+          ['['] = 95,
+          [']'] = 96,
+          ['f'] = 112,
+          ['t'] = 110,
+          ['{'] = 150,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1237,28 +1257,32 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
           ('a' <= lookahead && lookahead <= 'z')) ADVANCE(141);
       END_STATE();
     case 3:
-      ADVANCE_MAP(
-        '\n', 34,
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '(', 144,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '|', 32,
-        '\t', 39,
-        '\f', 39,
-        '\r', 39,
-        ' ', 39,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 40,
+          ['\n'] = 35,
+          ['\f'] = 40,
+          ['\r'] = 40,
+          [32] = 40,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['('] = 145,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+          ['|'] = 33,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
@@ -1266,27 +1290,31 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       if (lookahead != 0) ADVANCE(51);
       END_STATE();
     case 4:
-      ADVANCE_MAP(
-        '\n', 34,
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '|', 32,
-        '\t', 39,
-        '\f', 39,
-        '\r', 39,
-        ' ', 39,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 40,
+          ['\n'] = 35,
+          ['\f'] = 40,
+          ['\r'] = 40,
+          [32] = 40,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+          ['|'] = 33,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
@@ -1377,45 +1405,49 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 25:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 166,
-        '"', 5,
-        '#', 35,
-        '&', 7,
-        '\'', 8,
-        '(', 147,
-        ')', 145,
-        '*', 177,
-        '+', 175,
-        ',', 146,
-        '-', 169,
-        '.', 9,
-        '/', 179,
-        ':', 83,
-        '<', 157,
-        '=', 85,
-        '>', 159,
-        '?', 194,
-        '[', 94,
-        ']', 95,
-        '_', 141,
-        'a', 105,
-        'b', 98,
-        'c', 106,
-        'd', 104,
-        'f', 102,
-        'l', 97,
-        'n', 107,
-        's', 100,
-        't', 99,
-        'v', 96,
-        '{', 149,
-        '|', 33,
-        '}', 150,
-        'g', 101,
-        'w', 101,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 167,
+          ['"'] = 6,
+          ['#'] = 36,
+          ['&'] = 8,
+          ['\''] = 9,
+          ['('] = 148,
+          [')'] = 146,
+          ['*'] = 178,
+          ['+'] = 176,
+          [','] = 147,
+          ['-'] = 170,
+          ['.'] = 10,
+          ['/'] = 180,
+          [':'] = 84,
+          ['<'] = 158,
+          ['='] = 86,
+          ['>'] = 160,
+          ['?'] = 195,
+          ['['] = 95,
+          [']'] = 96,
+          ['_'] = 142,
+          ['a'] = 106,
+          ['b'] = 99,
+          ['c'] = 107,
+          ['d'] = 105,
+          ['f'] = 103,
+          ['g'] = 102,
+          ['l'] = 98,
+          ['n'] = 108,
+          ['s'] = 101,
+          ['t'] = 100,
+          ['v'] = 97,
+          ['w'] = 102,
+          ['{'] = 150,
+          ['|'] = 34,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1426,29 +1458,33 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 26:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 12,
-        '"', 5,
-        '&', 6,
-        '\'', 8,
-        ')', 145,
-        '*', 176,
-        '+', 174,
-        ',', 146,
-        '-', 170,
-        '.', 10,
-        '/', 178,
-        ':', 83,
-        '<', 157,
-        '=', 16,
-        '>', 159,
-        '?', 194,
-        '[', 94,
-        ']', 95,
-        '|', 33,
-        '}', 150,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 13,
+          ['"'] = 6,
+          ['&'] = 7,
+          ['\''] = 9,
+          [')'] = 146,
+          ['*'] = 177,
+          ['+'] = 175,
+          [','] = 147,
+          ['-'] = 171,
+          ['.'] = 11,
+          ['/'] = 179,
+          [':'] = 84,
+          ['<'] = 158,
+          ['='] = 17,
+          ['>'] = 160,
+          ['?'] = 195,
+          ['['] = 95,
+          [']'] = 96,
+          ['|'] = 34,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1459,35 +1495,39 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 27:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 12,
-        '&', 6,
-        '(', 144,
-        ')', 145,
-        '*', 177,
-        '+', 175,
-        ',', 146,
-        '-', 169,
-        '.', 9,
-        '/', 179,
-        ':', 83,
-        '<', 157,
-        '=', 86,
-        '>', 159,
-        '?', 194,
-        '[', 94,
-        ']', 95,
-        'a', 125,
-        'b', 128,
-        'd', 118,
-        'f', 123,
-        'l', 119,
-        'n', 138,
-        's', 134,
-        '|', 33,
-        '}', 150,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 13,
+          ['&'] = 7,
+          ['('] = 145,
+          [')'] = 146,
+          ['*'] = 178,
+          ['+'] = 176,
+          [','] = 147,
+          ['-'] = 170,
+          ['.'] = 10,
+          ['/'] = 180,
+          [':'] = 84,
+          ['<'] = 158,
+          ['='] = 87,
+          ['>'] = 160,
+          ['?'] = 195,
+          ['['] = 95,
+          [']'] = 96,
+          ['a'] = 126,
+          ['b'] = 129,
+          ['d'] = 119,
+          ['f'] = 124,
+          ['l'] = 120,
+          ['n'] = 139,
+          ['s'] = 135,
+          ['|'] = 34,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1498,34 +1538,38 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 28:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '\n', 34,
-        '!', 12,
-        '&', 6,
-        ')', 145,
-        '*', 177,
-        '+', 175,
-        ',', 146,
-        '-', 169,
-        '.', 9,
-        '/', 179,
-        ':', 83,
-        '<', 157,
-        '=', 86,
-        '>', 159,
-        '?', 194,
-        '[', 94,
-        ']', 95,
-        'a', 125,
-        'b', 128,
-        'd', 118,
-        'f', 123,
-        'l', 119,
-        'n', 138,
-        's', 134,
-        '|', 33,
-        '}', 150,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\n'] = 35,
+          ['!'] = 13,
+          ['&'] = 7,
+          [')'] = 146,
+          ['*'] = 178,
+          ['+'] = 176,
+          [','] = 147,
+          ['-'] = 170,
+          ['.'] = 10,
+          ['/'] = 180,
+          [':'] = 84,
+          ['<'] = 158,
+          ['='] = 87,
+          ['>'] = 160,
+          ['?'] = 195,
+          ['['] = 95,
+          [']'] = 96,
+          ['a'] = 126,
+          ['b'] = 129,
+          ['d'] = 119,
+          ['f'] = 124,
+          ['l'] = 120,
+          ['n'] = 139,
+          ['s'] = 135,
+          ['|'] = 34,
+          ['}'] = 151,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (lookahead == '\t' ||
           lookahead == '\f' ||
           lookahead == '\r' ||
@@ -1536,26 +1580,30 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 29:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '(', 144,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '\t', 41,
-        '\f', 41,
-        '\r', 41,
-        ' ', 41,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 42,
+          ['\f'] = 42,
+          ['\r'] = 42,
+          [32] = 42,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['('] = 145,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
@@ -1567,25 +1615,29 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 30:
       if (eof) ADVANCE(31);
-      ADVANCE_MAP(
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '\t', 41,
-        '\f', 41,
-        '\r', 41,
-        ' ', 41,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 42,
+          ['\f'] = 42,
+          ['\r'] = 42,
+          [32] = 42,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
@@ -1631,27 +1683,31 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 39:
       ACCEPT_TOKEN(sym_raw_text);
-      ADVANCE_MAP(
-        '\n', 34,
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '|', 32,
-        '\t', 39,
-        '\f', 39,
-        '\r', 39,
-        ' ', 39,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 40,
+          ['\n'] = 35,
+          ['\f'] = 40,
+          ['\r'] = 40,
+          [32] = 40,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+          ['|'] = 33,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
@@ -1668,25 +1724,29 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
       END_STATE();
     case 41:
       ACCEPT_TOKEN(sym_raw_text);
-      ADVANCE_MAP(
-        '"', 40,
-        '&', 50,
-        '\'', 42,
-        '<', 43,
-        '[', 94,
-        '{', 149,
-        '\t', 41,
-        '\f', 41,
-        '\r', 41,
-        ' ', 41,
-        'b', 142,
-        'g', 142,
-        'l', 142,
-        's', 142,
-        't', 142,
-        'v', 142,
-        'w', 142,
-      );
+      // vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1
+      if ((uint32_t)lookahead < 128) {
+        static const uint8_t map[128] = {
+          ['\t'] = 42,
+          ['\f'] = 42,
+          ['\r'] = 42,
+          [32] = 42,
+          ['"'] = 41,
+          ['&'] = 51,
+          ['\''] = 43,
+          ['<'] = 44,
+          ['['] = 95,
+          ['b'] = 143,
+          ['g'] = 143,
+          ['l'] = 143,
+          ['s'] = 143,
+          ['t'] = 143,
+          ['v'] = 143,
+          ['w'] = 143,
+          ['{'] = 150,
+        };
+        ADVANCE_TABLE(map);
+      }
       if (('0' <= lookahead && lookahead <= '9')) ADVANCE(162);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
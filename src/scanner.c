@@ -0,0 +1,573 @@
+// scanner.c
+// 外部扫描器：在语句开头识别 Ex 命令名。
+// - 按 keywords.h 生成的字典树匹配，支持缩写（fu / func / function），
+//   每个字符一次查表，不做字符串比较
+// - 已知命令给出对应 kwid 的 token，其余给 UNKNOWN_COMMAND
+// - 名字后面像赋值、调用、索引时返回 false，交给内部词法器按 identifier 处理
+// - 向前看区分 lambda 的 ( 与普通括号、代码块的 { 与 dict，语法里不再声明冲突
+// - comment、string 和映射等命令的参数是长而不透明的 token，在这里用一个
+//   紧凑的循环扫到终止符，不经过内部词法器逐字符的状态跳转
+// - 下一行以 \ 或运算符（-> .. + ? : && ||）开头时，换行连同缩进作为 extras 里的
+//   续行 token，多行表达式和 ->map()->filter() 链仍是同一条语句
+// - lua << [trim] EOF 之类的 heredoc：结束标记记在扫描器状态里，
+//   正文整段作为一个 token
+// - 块没有收尾时（def 缺 enddef、if 缺 endif）第 0 列的 def / export / vim9script
+//   照样给出关键字 token，运行时的错误恢复据此插入零宽的 MISSING enddef/endif/endfor，
+//   错误只影响没写完的那个块，不会把后面整个文件吞进 ERROR
+
+#include "tree_sitter/alloc.h"
+#include "tree_sitter/parser.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char *mandat;
+    const char *opt;
+    bool ignore_comments_after;
+} keyword;
+
+#include "keywords.h"
+
+// 排在关键字之后的外部 token，顺序与 grammar.js 的 externals 一致
+enum {
+    LAMBDA_OPEN = UNKNOWN_COMMAND + 1,
+    BLOCK_OPEN,
+    STRING,
+    COMMENT,
+    RAW_ARGUMENTS,
+    HEREDOC_START,
+    HEREDOC_BODY,
+    HEREDOC_END,
+    LINE_CONTINUATION,
+    ERROR_SENTINEL,
+};
+
+#define HEREDOC_MARKER_MAX 64
+
+// 正在读的 heredoc；length 为 0 表示不在 heredoc 里。
+// autocmd：上一个外部 token 是 autocmd，它的参数连同 | 一直到行尾
+typedef struct {
+    uint8_t length;
+    bool trim;
+    bool autocmd;
+    char marker[HEREDOC_MARKER_MAX];
+} Scanner;
+
+static inline bool is_alpha(int32_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static inline bool is_digit(int32_t c) { return c >= '0' && c <= '9'; }
+
+static inline bool is_blank(int32_t c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f';
+}
+
+// 只能出现在顶层的关键字：出现在第 0 列就说明前面的块已经结束
+static bool starts_top_level(kwid id) {
+    return id == DEF || id == EXPORT || id == VIM9SCRIPT;
+}
+
+// 顶层块（语法里 def/if/for 不嵌套）的正文里，语句开头可以是收尾关键字
+static bool in_open_block(const bool *valid_symbols) {
+    return valid_symbols[ENDDEF] || valid_symbols[ENDIF] || valid_symbols[ENDFOR];
+}
+
+// 由语法规则单独处理的关键字：不套用表达式判断，也不退化成未知命令
+static bool is_block_keyword(kwid id) {
+    switch (id) {
+        case VIM9SCRIPT:
+        case EXPORT:
+        case DEF:
+        case ENDDEF:
+        case VAR:
+        case CONST:
+        case IF:
+        case ELSEIF:
+        case ELSE:
+        case ENDIF:
+        case FOR:
+        case ENDFOR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 字典树的下一个状态；0 表示已经不可能是关键字
+static inline uint16_t keyword_trie_next(uint16_t state, int32_t c) {
+    if (c < 0 || c >= 128 || keyword_char_class[c] == 0) {
+        return 0;
+    }
+    return keyword_trie[state][keyword_char_class[c]];
+}
+
+// 名字之后（已 mark_end）向后看，判断这一行是不是表达式语句或赋值。
+// 块关键字后面紧跟的 ( 是条件的括号（if(x)、elseif(x)），不当作调用
+static bool looks_like_expression(TSLexer *lexer, bool block_keyword) {
+    if (lexer->lookahead == '(' && block_keyword) {
+        return false;
+    }
+    switch (lexer->lookahead) {
+        case '(': // Foo()
+        case '[': // x[1] = 2
+        case '.': // x.y = 1
+        case ':': // g:x = 1
+        case '#': // foo#bar()
+        case '_': // my_var = 1
+            return true;
+        default:
+            break;
+    }
+
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+
+    switch (lexer->lookahead) {
+        case '=':
+            lexer->advance(lexer, false);
+            return lexer->lookahead != '=' && lexer->lookahead != '~';
+        case '+':
+        case '*':
+        case '/':
+        case '%':
+            lexer->advance(lexer, false);
+            return lexer->lookahead == '=';
+        case '-':
+            lexer->advance(lexer, false);
+            return lexer->lookahead == '=' || lexer->lookahead == '>';
+        case '.':
+            lexer->advance(lexer, false);
+            if (lexer->lookahead != '.') {
+                return false;
+            }
+            lexer->advance(lexer, false);
+            return lexer->lookahead == '=';
+        default:
+            return false;
+    }
+}
+
+static inline bool is_line_end(TSLexer *lexer) {
+    return lexer->lookahead == '\n' || lexer->eof(lexer);
+}
+
+// 跳过引号内的内容，停在右引号之后，返回读过的字符数；遇到换行就放弃，返回 0。
+// 只有 "..." 认 \ 转义；'...' 里 \ 是普通字符，'' 表示一个单引号
+static unsigned skip_string(TSLexer *lexer) {
+    int32_t quote = lexer->lookahead;
+    lexer->advance(lexer, false);
+    unsigned length = 1;
+    for (;;) {
+        if (is_line_end(lexer)) {
+            return 0;
+        }
+        if (lexer->lookahead == quote) {
+            lexer->advance(lexer, false);
+            length++;
+            if (quote == '"' || lexer->lookahead != '\'') {
+                return length;
+            }
+        } else if (lexer->lookahead == '\\' && quote == '"') {
+            lexer->advance(lexer, false);
+            length++;
+            if (is_line_end(lexer)) {
+                return 0;
+            }
+        }
+        lexer->advance(lexer, false);
+        length++;
+    }
+}
+
+// 字符串不跨行；没闭合就返回 false，这一行交给内部词法器（通常成为 raw_text）
+static bool scan_string(TSLexer *lexer) {
+    if (!skip_string(lexer)) {
+        return false;
+    }
+    lexer->result_symbol = STRING;
+    return true;
+}
+
+// lookahead 是换行：看下一行去掉缩进后的开头。旧式的 \ 连同换行和缩进都是空白；
+// 运算符开头的 Vim9 续行只吃换行和缩进，运算符留给内部词法器
+static bool scan_line_continuation(TSLexer *lexer) {
+    lexer->advance(lexer, false);
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+    lexer->mark_end(lexer);
+    lexer->result_symbol = LINE_CONTINUATION;
+    int32_t first = lexer->lookahead;
+    switch (first) {
+        case '\\':
+            lexer->advance(lexer, false);
+            lexer->mark_end(lexer);
+            return true;
+        case '+':
+            return true;
+        case '?':
+        case ':':
+            // 三元运算符两边必须有空白；:echo x 是一条新命令，不是续行
+            lexer->advance(lexer, false);
+            return is_blank(lexer->lookahead);
+        case '-':
+        case '.':
+        case '&':
+        case '|':
+            // -> .. && ||；单个 - . & | 不算（&opt 赋值、| 链）
+            lexer->advance(lexer, false);
+            return lexer->lookahead == (first == '-' ? '>' : first);
+        default:
+            return false;
+    }
+}
+
+// # 到行尾
+static bool scan_comment(TSLexer *lexer) {
+    do {
+        lexer->advance(lexer, false);
+    } while (!is_line_end(lexer));
+    lexer->result_symbol = COMMENT;
+    return true;
+}
+
+// 映射等命令的参数：到换行或未转义的 | 为止，\| 和 <Bar> 留在参数里；
+// autocmd 的 | 属于它要执行的命令，只到换行为止
+static bool scan_raw_rest(TSLexer *lexer, bool autocmd) {
+    while (!is_line_end(lexer) && (autocmd || lexer->lookahead != '|')) {
+        if (lexer->lookahead == '\\') {
+            lexer->advance(lexer, false);
+            if (is_line_end(lexer)) {
+                break;
+            }
+        }
+        lexer->advance(lexer, false);
+    }
+    lexer->result_symbol = RAW_ARGUMENTS;
+    return true;
+}
+
+static bool scan_raw_arguments(TSLexer *lexer, bool autocmd) {
+    if (is_line_end(lexer) || (!autocmd && lexer->lookahead == '|')) {
+        return false;
+    }
+    return scan_raw_rest(lexer, autocmd);
+}
+
+// 读一个不含空白的词，返回长度；放不下或含非 ASCII 字符时返回 size + 1
+static unsigned read_word(TSLexer *lexer, char *word, unsigned size) {
+    unsigned n = 0;
+    while (!is_line_end(lexer) && !is_blank(lexer->lookahead)) {
+        if (n < size && lexer->lookahead < 128) {
+            word[n++] = (char)lexer->lookahead;
+        } else {
+            n = size + 1;
+        }
+        lexer->advance(lexer, false);
+    }
+    return n;
+}
+
+static void skip_blanks(TSLexer *lexer) {
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+}
+
+// 当前在 < 上：<< [trim] [marker] 到行尾（连同换行），省略 marker 时为 "."；
+// 这一行不是 heredoc 时按普通参数处理
+static bool scan_heredoc_start(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
+    lexer->advance(lexer, false);
+    if (lexer->lookahead == '<') {
+        lexer->advance(lexer, false);
+        skip_blanks(lexer);
+
+        char marker[HEREDOC_MARKER_MAX];
+        bool trim = false;
+        unsigned length = read_word(lexer, marker, HEREDOC_MARKER_MAX);
+        if (length == 4 && memcmp(marker, "trim", 4) == 0) {
+            trim = true;
+            skip_blanks(lexer);
+            length = read_word(lexer, marker, HEREDOC_MARKER_MAX);
+        }
+        skip_blanks(lexer);
+
+        if (length <= HEREDOC_MARKER_MAX && is_line_end(lexer)) {
+            if (length == 0) {
+                marker[length++] = '.';
+            }
+            if (!lexer->eof(lexer)) {
+                lexer->advance(lexer, false);
+            }
+            scanner->length = (uint8_t)length;
+            scanner->trim = trim;
+            memcpy(scanner->marker, marker, length);
+            lexer->result_symbol = HEREDOC_START;
+            return true;
+        }
+    }
+    return valid_symbols[RAW_ARGUMENTS] && scan_raw_rest(lexer, false);
+}
+
+// 当前在行首：这一行是不是结束标记（trim 时允许缩进，行尾允许空白）
+static bool at_heredoc_end(const Scanner *scanner, TSLexer *lexer) {
+    if (scanner->trim) {
+        skip_blanks(lexer);
+    }
+    for (unsigned i = 0; i < scanner->length; i++) {
+        if (lexer->lookahead != (unsigned char)scanner->marker[i]) {
+            return false;
+        }
+        lexer->advance(lexer, false);
+    }
+    skip_blanks(lexer);
+    return is_line_end(lexer);
+}
+
+// heredoc 正文：逐行找结束标记，之前的所有行是一个 HEREDOC_BODY；
+// 正文为空时直接给出 HEREDOC_END
+static bool scan_heredoc(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
+    for (bool in_body = false;; in_body = true) {
+        lexer->mark_end(lexer);
+        if (at_heredoc_end(scanner, lexer)) {
+            if (in_body) {
+                lexer->result_symbol = HEREDOC_BODY;
+                return valid_symbols[HEREDOC_BODY];
+            }
+            if (!valid_symbols[HEREDOC_END]) {
+                return false;
+            }
+            lexer->mark_end(lexer);
+            scanner->length = 0;
+            lexer->result_symbol = HEREDOC_END;
+            return true;
+        }
+
+        while (!is_line_end(lexer)) {
+            lexer->advance(lexer, false);
+        }
+        if (lexer->eof(lexer)) {
+            // 没有结束标记：正文一直到文件末尾
+            lexer->mark_end(lexer);
+            lexer->result_symbol = HEREDOC_BODY;
+            return valid_symbols[HEREDOC_BODY] && (in_body || lexer->get_column(lexer) > 0);
+        }
+        lexer->advance(lexer, false);
+    }
+}
+
+// lambda 的参数表很短：( 之后这么多个字符内没有配对的 ) 就不是 lambda。
+// 不设上限时，一行里层层嵌套的 ( 每个都要扫到配对处，整行是平方级
+#define LAMBDA_LOOKAHEAD_MAX 256
+
+// 当前在 ( 上：扫到同一行内配对的 )，后面跟 => 才是 lambda
+static bool scan_lambda_open(TSLexer *lexer) {
+    lexer->advance(lexer, false);
+    lexer->mark_end(lexer);
+
+    unsigned depth = 1;
+    unsigned scanned = 0;
+    while (depth > 0) {
+        if (scanned >= LAMBDA_LOOKAHEAD_MAX) {
+            return false;
+        }
+        switch (lexer->lookahead) {
+            case '\n':
+                return false;
+            case '"':
+            case '\'': {
+                unsigned length = skip_string(lexer);
+                if (length == 0) {
+                    return false;
+                }
+                scanned += length;
+                continue;
+            }
+            case '(':
+                depth++;
+                break;
+            case ')':
+                depth--;
+                break;
+            default:
+                if (lexer->eof(lexer)) {
+                    return false;
+                }
+                break;
+        }
+        lexer->advance(lexer, false);
+        scanned++;
+    }
+
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+    if (lexer->lookahead != '=') {
+        return false;
+    }
+    lexer->advance(lexer, false);
+    if (lexer->lookahead != '>') {
+        return false;
+    }
+    lexer->result_symbol = LAMBDA_OPEN;
+    return true;
+}
+
+// 当前在 { 上：后面只剩空白、注释或换行才是代码块
+static bool scan_block_open(TSLexer *lexer) {
+    lexer->advance(lexer, false);
+    lexer->mark_end(lexer);
+
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, false);
+    }
+    if (lexer->lookahead != '\n' && lexer->lookahead != '#') {
+        return false;
+    }
+    lexer->result_symbol = BLOCK_OPEN;
+    return true;
+}
+
+void *tree_sitter_vim9_external_scanner_create(void) { return ts_calloc(1, sizeof(Scanner)); }
+
+void tree_sitter_vim9_external_scanner_destroy(void *payload) { ts_free(payload); }
+
+// [length][trim][autocmd][marker...]；状态为空时不写任何内容
+unsigned tree_sitter_vim9_external_scanner_serialize(void *payload, char *buffer) {
+    Scanner *scanner = payload;
+    if (scanner->length == 0 && !scanner->autocmd) {
+        return 0;
+    }
+    buffer[0] = (char)scanner->length;
+    buffer[1] = (char)scanner->trim;
+    buffer[2] = (char)scanner->autocmd;
+    memcpy(buffer + 3, scanner->marker, scanner->length);
+    return 3 + scanner->length;
+}
+
+void tree_sitter_vim9_external_scanner_deserialize(void *payload, const char *buffer,
+                                                   unsigned length) {
+    Scanner *scanner = payload;
+    scanner->length = 0;
+    scanner->trim = false;
+    scanner->autocmd = false;
+    if (length >= 3 && (unsigned char)buffer[0] + 3u == length) {
+        scanner->length = (uint8_t)buffer[0];
+        scanner->trim = buffer[1];
+        scanner->autocmd = buffer[2];
+        memcpy(scanner->marker, buffer + 3, scanner->length);
+    }
+}
+
+bool tree_sitter_vim9_external_scanner_scan(void *payload, TSLexer *lexer,
+                                            const bool *valid_symbols) {
+    Scanner *scanner = payload;
+    // 只对紧跟在 autocmd 后面的这一次扫描有效
+    bool autocmd = scanner->autocmd;
+    scanner->autocmd = false;
+
+    // heredoc 正文从行首开始，不能先跳过缩进
+    if (scanner->length > 0 && (valid_symbols[HEREDOC_BODY] || valid_symbols[HEREDOC_END])) {
+        return scan_heredoc(scanner, lexer, valid_symbols);
+    }
+
+    while (is_blank(lexer->lookahead)) {
+        lexer->advance(lexer, true);
+    }
+
+    // 错误恢复时所有符号都有效，这时不能把整行吞成参数
+    bool recovering = valid_symbols[ERROR_SENTINEL];
+    if (valid_symbols[LINE_CONTINUATION] && !recovering && lexer->lookahead == '\n') {
+        return scan_line_continuation(lexer);
+    }
+    if (valid_symbols[HEREDOC_START] && lexer->lookahead == '<' && !recovering) {
+        return scan_heredoc_start(scanner, lexer, valid_symbols);
+    }
+    if (valid_symbols[RAW_ARGUMENTS] && !recovering) {
+        return scan_raw_arguments(lexer, autocmd);
+    }
+
+    // 命令前可以有任意个 :（:echo x）；当作空白，不算进命令名
+    if (valid_symbols[UNKNOWN_COMMAND] && !recovering) {
+        while (lexer->lookahead == ':' || is_blank(lexer->lookahead)) {
+            lexer->advance(lexer, true);
+        }
+    }
+
+    switch (lexer->lookahead) {
+        case '(':
+            return valid_symbols[LAMBDA_OPEN] && scan_lambda_open(lexer);
+        case '{':
+            return valid_symbols[BLOCK_OPEN] && scan_block_open(lexer);
+        case '#':
+            return valid_symbols[COMMENT] && scan_comment(lexer);
+        case '"':
+        case '\'':
+            return valid_symbols[STRING] && scan_string(lexer);
+        default:
+            break;
+    }
+
+    if (!is_alpha(lexer->lookahead)) {
+        return false;
+    }
+
+    // 根状态不会被跳回，所以走到 0 之后一直停在 0
+    uint16_t state = 0;
+    bool matched = true;
+    uint32_t length = 0;
+    while (is_alpha(lexer->lookahead) || is_digit(lexer->lookahead)) {
+        if (matched) {
+            state = keyword_trie_next(state, lexer->lookahead);
+            matched = state != 0;
+        }
+        lexer->advance(lexer, false);
+        length++;
+    }
+
+    kwid id = matched ? (kwid)keyword_trie[state][0] : UNKNOWN_COMMAND;
+
+    if (is_block_keyword(id)) {
+        // 块里第 0 列的顶层关键字：语法上无效，但给出它才能让错误恢复在这里补上收尾
+        // （get_column 要回读整行，只在这种少见的情况下才调用）
+        if (!valid_symbols[id] &&
+            !(starts_top_level(id) && !recovering && in_open_block(valid_symbols) &&
+              lexer->get_column(lexer) == length)) {
+            return false;
+        }
+        lexer->mark_end(lexer);
+        // 缩写很短（en、el、cons、endfo）：el = 1、el->add(x)、en += 3、def_name、
+        // if#x 都只是以关键字开头的名字
+        if (looks_like_expression(lexer, true)) {
+            return false;
+        }
+        lexer->result_symbol = id;
+        return true;
+    }
+
+    if (id == UNKNOWN_COMMAND || !valid_symbols[id]) {
+        if (!valid_symbols[UNKNOWN_COMMAND]) {
+            return false;
+        }
+        id = UNKNOWN_COMMAND;
+    }
+
+    // function! / command! 之类：! 属于命令名
+    if (lexer->lookahead == '!') {
+        lexer->advance(lexer, false);
+    }
+    lexer->mark_end(lexer);
+
+    if (looks_like_expression(lexer, false)) {
+        return false;
+    }
+
+    scanner->autocmd = id == AUTOCMD;
+    lexer->result_symbol = id;
+    return true;
+}
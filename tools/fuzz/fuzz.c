@@ -0,0 +1,278 @@
+// fuzz.c
+// vim9-fuzz：找让 tree_sitter_vim9() 解析变慢或栈变深的输入。
+// 每个输入先不带 logger 计时解析一次，耗时超过 floor + ns_per_byte * 字节数 即判失败；
+// 再检查树的最大深度（近似解析栈的深度），以及（设定了上限时）带 logger 再解析一遍，
+// 看 GLR 栈版本数是否超限。失败时打印原因后 abort()，libFuzzer/AFL 会把输入存下来。
+//
+//   libFuzzer：cmake -DCMAKE_C_COMPILER=clang -DTREE_SITTER_VIM9_LIBFUZZER=ON，
+//              之后 vim9-fuzz bench/corpus
+//   AFL：      afl-fuzz -i bench/corpus -o out -- vim9-fuzz     （从 stdin 读一个输入）
+//   回放：      vim9-fuzz file-or-dir...   （逐个检查，不 abort，有失败时返回 1）
+//
+// 上限可以用环境变量调：VIM9_FUZZ_NS_PER_BYTE（默认 2000）、VIM9_FUZZ_FLOOR_NS
+// （默认 2000000，短输入不因计时抖动误报）、VIM9_FUZZ_MAX_DEPTH（默认 1024）、
+// VIM9_FUZZ_MAX_VERSIONS（默认 0，不检查；解析日志很慢）。
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9.h>
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+typedef struct {
+    uint64_t ns_per_byte;
+    uint64_t floor_ns;
+    uint32_t max_depth;
+    unsigned max_versions;
+} FuzzBudget;
+
+typedef struct {
+    uint64_t elapsed_ns;
+    uint64_t budget_ns;
+    uint32_t depth;
+    unsigned versions;
+} FuzzResult;
+
+static TSParser *parser;
+static FuzzBudget budget;
+
+static uint64_t env_or(const char *name, uint64_t fallback) {
+    const char *value = getenv(name);
+    return value && *value ? strtoull(value, NULL, 10) : fallback;
+}
+
+static bool fuzz_init(void) {
+    if (parser) {
+        return true;
+    }
+    budget = (FuzzBudget){
+        env_or("VIM9_FUZZ_NS_PER_BYTE", 2000),
+        env_or("VIM9_FUZZ_FLOOR_NS", 2000000),
+        (uint32_t)env_or("VIM9_FUZZ_MAX_DEPTH", 1024),
+        (unsigned)env_or("VIM9_FUZZ_MAX_VERSIONS", 0),
+    };
+    parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_vim9())) {
+        fprintf(stderr, "incompatible tree-sitter runtime\n");
+        ts_parser_delete(parser);
+        parser = NULL;
+        return false;
+    }
+    return true;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// 和 bench 一样从 "version_count:%u" 读栈版本数
+static void count_versions(void *payload, TSLogType type, const char *message) {
+    if (type != TSLogTypeParse) {
+        return;
+    }
+    const char *count = strstr(message, "version_count:");
+    if (count) {
+        unsigned versions = (unsigned)strtoul(count + strlen("version_count:"), NULL, 10);
+        unsigned *max = payload;
+        if (versions > *max) {
+            *max = versions;
+        }
+    }
+}
+
+static uint32_t tree_depth(TSTree *tree) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    uint32_t depth = 1, max = 1;
+    for (;;) {
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            if (++depth > max) {
+                max = depth;
+            }
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return max;
+            }
+            depth--;
+        }
+    }
+}
+
+// 超出任一上限时返回 false，原因写进 reason
+static bool fuzz_check(const uint8_t *data, size_t size, FuzzResult *result, const char **reason) {
+    *result = (FuzzResult){0};
+    *reason = NULL;
+    if (size > UINT32_MAX) {
+        return true;
+    }
+    uint64_t start = now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, (const char *)data, (uint32_t)size);
+    result->elapsed_ns = now_ns() - start;
+    result->budget_ns = budget.floor_ns + budget.ns_per_byte * size;
+    result->depth = tree_depth(tree);
+    ts_tree_delete(tree);
+
+    if (budget.max_versions) {
+        ts_parser_set_logger(parser, (TSLogger){&result->versions, count_versions});
+        ts_tree_delete(ts_parser_parse_string(parser, NULL, (const char *)data, (uint32_t)size));
+        ts_parser_set_logger(parser, (TSLogger){NULL, NULL});
+    }
+
+    if (result->elapsed_ns > result->budget_ns) {
+        *reason = "parse time over budget";
+    } else if (result->depth > budget.max_depth) {
+        *reason = "tree deeper than VIM9_FUZZ_MAX_DEPTH";
+    } else if (budget.max_versions && result->versions > budget.max_versions) {
+        *reason = "more stack versions than VIM9_FUZZ_MAX_VERSIONS";
+    }
+    return *reason == NULL;
+}
+
+static void report(const char *name, size_t size, const FuzzResult *result, const char *reason) {
+    fprintf(stderr,
+            "%s: %s: %zu bytes, %.3f ms (budget %.3f ms, %.1f ns/byte), depth %u",
+            name, reason, size, (double)result->elapsed_ns / 1e6,
+            (double)result->budget_ns / 1e6,
+            size ? (double)result->elapsed_ns / (double)size : 0.0, result->depth);
+    if (budget.max_versions) {
+        fprintf(stderr, ", %u stack version(s)", result->versions);
+    }
+    fprintf(stderr, "\n");
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    if (!fuzz_init()) {
+        abort();
+    }
+    FuzzResult result;
+    const char *reason;
+    if (!fuzz_check(data, size, &result, &reason)) {
+        report("input", size, &result, reason);
+        abort();
+    }
+    return 0;
+}
+
+#ifndef VIM9_FUZZ_LIBFUZZER
+
+static uint8_t *read_stream(FILE *file, size_t *size) {
+    size_t capacity = 1 << 16;
+    uint8_t *data = malloc(capacity);
+    *size = 0;
+    size_t n;
+    while (data && (n = fread(data + *size, 1, capacity - *size, file)) > 0) {
+        *size += n;
+        if (*size == capacity) {
+            capacity *= 2;
+            uint8_t *grown = realloc(data, capacity);
+            if (!grown) {
+                free(data);
+                return NULL;
+            }
+            data = grown;
+        }
+    }
+    return data;
+}
+
+// 回放一个文件或目录（目录按 bench 的规矩只取 *.vim，递归）；返回失败个数
+static unsigned replay(const char *path, bool root, unsigned *files) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        perror(path);
+        return 1;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        DIR *dir = opendir(path);
+        if (!dir) {
+            perror(path);
+            return 1;
+        }
+        unsigned failures = 0;
+        struct dirent *entry;
+        while ((entry = readdir(dir))) {
+            if (entry->d_name[0] == '.') {
+                continue;
+            }
+            size_t length = strlen(path) + strlen(entry->d_name) + 2;
+            char *child = malloc(length);
+            snprintf(child, length, "%s/%s", path, entry->d_name);
+            failures += replay(child, false, files);
+            free(child);
+        }
+        closedir(dir);
+        return failures;
+    }
+    size_t n = strlen(path);
+    if (!root && (n < 4 || strcmp(path + n - 4, ".vim") != 0)) {
+        return 0;
+    }
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return 1;
+    }
+    size_t size;
+    uint8_t *data = read_stream(file, &size);
+    fclose(file);
+    if (!data) {
+        fprintf(stderr, "%s: out of memory\n", path);
+        return 1;
+    }
+    (*files)++;
+    FuzzResult result;
+    const char *reason;
+    bool ok = fuzz_check(data, size, &result, &reason);
+    if (!ok) {
+        report(path, size, &result, reason);
+    }
+    free(data);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)) {
+        fprintf(stderr, "usage: %s [file-or-dir...]   (no arguments: one input on stdin)\n",
+                argv[0]);
+        return 0;
+    }
+    if (!fuzz_init()) {
+        return 1;
+    }
+    int status = 0;
+    if (argc == 1) {
+        size_t size;
+        uint8_t *data = read_stream(stdin, &size);
+        if (!data) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        LLVMFuzzerTestOneInput(data, size);
+        free(data);
+    } else {
+        unsigned files = 0, failures = 0;
+        for (int i = 1; i < argc; i++) {
+            failures += replay(argv[i], true, &files);
+        }
+        printf("%u file(s) checked, %u over budget or unreadable\n", files, failures);
+        status = failures ? 1 : 0;
+    }
+    ts_parser_delete(parser);
+    return status;
+}
+
+#endif
@@ -0,0 +1,197 @@
+// extract.c
+// 遍历语法树，抽出 def / var / const / 命令，写成 NDJSON 记录。
+//
+//   {"path": "...", "kind": "def", "name": "Foo", "exported": true, "row": 3, "column": 0}
+
+#include "index.h"
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void index_buffer_append(IndexBuffer *b, const char *data, size_t length) {
+    if (b->length + length + 1 > b->capacity) {
+        b->capacity = (b->length + length + 1) * 2;
+        b->data = realloc(b->data, b->capacity);
+    }
+    memcpy(b->data + b->length, data, length);
+    b->length += length;
+    b->data[b->length] = '\0';
+}
+
+void index_buffer_printf(IndexBuffer *b, const char *format, ...) {
+    char small[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (n < 0) {
+        return;
+    }
+    if ((size_t)n < sizeof(small)) {
+        index_buffer_append(b, small, (size_t)n);
+        return;
+    }
+    char *large = malloc((size_t)n + 1);
+    va_start(args, format);
+    vsnprintf(large, (size_t)n + 1, format, args);
+    va_end(args);
+    index_buffer_append(b, large, (size_t)n);
+    free(large);
+}
+
+void index_buffer_json_string(IndexBuffer *b, const char *data, size_t length) {
+    index_buffer_append(b, "\"", 1);
+    size_t run = 0;
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char)data[i];
+        if (c != '"' && c != '\\' && c >= 0x20) {
+            continue;
+        }
+        index_buffer_append(b, data + run, i - run);
+        run = i + 1;
+        switch (c) {
+            case '"': index_buffer_append(b, "\\\"", 2); break;
+            case '\\': index_buffer_append(b, "\\\\", 2); break;
+            case '\n': index_buffer_append(b, "\\n", 2); break;
+            case '\t': index_buffer_append(b, "\\t", 2); break;
+            default: index_buffer_printf(b, "\\u%04x", c); break;
+        }
+    }
+    index_buffer_append(b, data + run, length - run);
+    index_buffer_append(b, "\"", 1);
+}
+
+static TSSymbol lookup_symbol(const TSLanguage *language, const char *name) {
+    return ts_language_symbol_for_name(language, name, (uint32_t)strlen(name), true);
+}
+
+// 语言里没有的 symbol 记为 0（不会和任何节点相等），只索引它有的那几种；
+// 一种都没有才算失败
+bool index_symbols_init(IndexSymbols *symbols, const TSLanguage *language) {
+    symbols->def_function = lookup_symbol(language, "def_function");
+    symbols->let_statement = lookup_symbol(language, "let_statement");
+    symbols->const_statement = lookup_symbol(language, "const_statement");
+    symbols->command = lookup_symbol(language, "command");
+    symbols->name_field = ts_language_field_id_for_name(language, "name", 4);
+    return symbols->def_function || symbols->let_statement || symbols->const_statement ||
+           symbols->command;
+}
+
+// 有 name field 时取它；没有 field 的语言里名字是第一个具名子节点
+// （var/const 后的 identifier、命令的 command_name）
+static TSNode declared_name(const IndexSymbols *symbols, TSNode node) {
+    if (symbols->name_field) {
+        return ts_node_child_by_field_id(node, symbols->name_field);
+    }
+    return ts_node_named_child(node, 0);
+}
+
+// def 前面可选的 export 关键字是第一个匿名子节点
+static bool is_exported(TSNode node) {
+    TSNode first = ts_node_child(node, 0);
+    return !ts_node_is_null(first) && !ts_node_is_named(first) &&
+           strcmp(ts_node_type(first), "export") == 0;
+}
+
+static void emit(IndexBuffer *out, const char *path, const char *kind, TSNode name,
+                 const char *source, bool exported) {
+    uint32_t start = ts_node_start_byte(name);
+    uint32_t end = ts_node_end_byte(name);
+    TSPoint point = ts_node_start_point(name);
+    index_buffer_append(out, "{\"path\": ", 9);
+    index_buffer_json_string(out, path, strlen(path));
+    index_buffer_printf(out, ", \"kind\": \"%s\", \"name\": ", kind);
+    index_buffer_json_string(out, source + start, end - start);
+    index_buffer_printf(out, ", \"exported\": %s, \"row\": %u, \"column\": %u}\n",
+                        exported ? "true" : "false", point.row, point.column);
+}
+
+void index_extract(const IndexSymbols *symbols, TSTree *tree, const char *path,
+                   const char *source, uint32_t length, IndexBuffer *out) {
+    TSNode root = ts_tree_root_node(tree);
+    index_buffer_append(out, "{\"path\": ", 9);
+    index_buffer_json_string(out, path, strlen(path));
+    index_buffer_printf(out, ", \"kind\": \"file\", \"bytes\": %u, \"has_error\": %s}\n", length,
+                        ts_node_has_error(root) ? "true" : "false");
+
+    // 先序遍历整棵树：def 体里的 var 和命令也要索引
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        TSSymbol symbol = ts_node_symbol(node);
+        const char *kind = NULL;
+        if (symbol == symbols->def_function) {
+            kind = "def";
+        } else if (symbol == symbols->let_statement) {
+            kind = "var";
+        } else if (symbol == symbols->const_statement) {
+            kind = "const";
+        } else if (symbol == symbols->command) {
+            kind = "command";
+        }
+        if (kind) {
+            TSNode name = declared_name(symbols, node);
+            if (!ts_node_is_null(name) && !ts_node_is_missing(name)) {
+                emit(out, path, kind, name, source, symbol == symbols->def_function &&
+                                                        is_exported(node));
+            }
+        }
+
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+static const TreeSitterVim9SymbolFootprint *sort_entries;
+
+static int compare_bytes(const void *a, const void *b) {
+    uint64_t x = sort_entries[*(const uint32_t *)a].bytes;
+    uint64_t y = sort_entries[*(const uint32_t *)b].bytes;
+    return (x < y) - (x > y);
+}
+
+void index_footprint_records(const TreeSitterVim9Footprint *footprint,
+                             const TSLanguage *language, IndexBuffer *out) {
+    uint32_t *order = malloc((footprint->symbol_count ? footprint->symbol_count : 1) *
+                             sizeof(uint32_t));
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < footprint->symbol_count; i++) {
+        if (footprint->symbols[i].nodes) {
+            order[count++] = i;
+        }
+    }
+    // 只在所有 worker 结束后单线程调用
+    sort_entries = footprint->symbols;
+    qsort(order, count, sizeof(uint32_t), compare_bytes);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t index = order[i];
+        const TreeSitterVim9SymbolFootprint *entry = &footprint->symbols[index];
+        const char *name = tree_sitter_vim9_footprint_symbol_name(footprint, language, index);
+        bool named = index + 1 == footprint->symbol_count ||
+                     ts_language_symbol_type(language, (TSSymbol)index) == TSSymbolTypeRegular;
+        index_buffer_append(out, "{\"kind\": \"memory\", \"symbol\": ", 29);
+        index_buffer_json_string(out, name, strlen(name));
+        index_buffer_printf(out,
+                            ", \"named\": %s, \"nodes\": %" PRIu64 ", \"bytes\": %" PRIu64
+                            ", \"max_depth\": %u}\n",
+                            named ? "true" : "false", entry->nodes, entry->bytes,
+                            entry->max_depth);
+    }
+    index_buffer_printf(out,
+                        "{\"kind\": \"memory_total\", \"trees\": %" PRIu64 ", \"nodes\": %" PRIu64
+                        ", \"bytes\": %" PRIu64 ", \"max_depth\": %u}\n",
+                        footprint->trees, footprint->nodes, footprint->bytes,
+                        footprint->max_depth);
+    free(order);
+}
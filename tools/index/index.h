@@ -0,0 +1,68 @@
+// index.h
+// vim9-index：多线程扫描目录下的 .vim 文件，按 NDJSON 输出 def、导出符号、
+// var/const 声明和命令。调度器见 pool.c，抽取见 extract.c。
+
+#ifndef VIM9_INDEX_H_
+#define VIM9_INDEX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vim9-footprint.h>
+#include <tree_sitter/tree-sitter-vim9.h>
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} IndexBuffer;
+
+void index_buffer_append(IndexBuffer *b, const char *data, size_t length);
+void index_buffer_printf(IndexBuffer *b, const char *format, ...);
+// JSON 字符串字面量（带引号）
+void index_buffer_json_string(IndexBuffer *b, const char *data, size_t length);
+
+// 语言里要用到的 symbol / field id，启动时查一次，之后只比较整数
+typedef struct {
+    TSSymbol def_function;
+    TSSymbol let_statement;
+    TSSymbol const_statement;
+    TSSymbol command;
+    TSFieldId name_field;
+} IndexSymbols;
+
+bool index_symbols_init(IndexSymbols *symbols, const TSLanguage *language);
+
+// 把一个文件的全部记录追加到 out，每条一行
+void index_extract(const IndexSymbols *symbols, TSTree *tree, const char *path,
+                   const char *source, uint32_t length, IndexBuffer *out);
+
+typedef struct {
+    unsigned threads;
+    bool verbose;
+    bool arena;  // 每个文件在本线程的 arena 里新建 parser，解析完整体 reset
+    bool memory;  // 按 symbol 统计树的内存占用，全部完成后输出
+} IndexOptions;
+
+typedef struct {
+    uint64_t files;
+    uint64_t bytes;
+    uint64_t error_files;
+    uint64_t failed;
+    uint64_t steals;
+    TreeSitterVim9Footprint footprint;  // --memory 时各 worker 的合计，调用方释放
+} IndexStats;
+
+// 每个 worker 一个 TSParser 和一个双端队列；空闲时从别的 worker 队头偷任务。
+// 目录也是任务，所以遍历本身也是并行的。
+bool index_run(char **roots, size_t root_count, const IndexOptions *options,
+               IndexStats *stats);
+
+// --memory 的输出：每个出现过的 symbol 一条 "memory" 记录（按字节数从大到小），
+// 最后一条 "memory_total"
+void index_footprint_records(const TreeSitterVim9Footprint *footprint,
+                             const TSLanguage *language, IndexBuffer *out);
+
+#endif // VIM9_INDEX_H_
@@ -0,0 +1,296 @@
+// pool.c
+// 工作窃取调度：每个 worker 有自己的双端队列，从队尾取（刚遍历出来的文件，
+// 缓存还热），空闲时从别的 worker 队头偷（最早入队、通常是目录，偷一次能分到一批活）。
+// 队列用各自的互斥锁保护；锁只在入队/出队时持有，解析本身不持锁。
+
+#define _POSIX_C_SOURCE 200809L
+
+#define TREE_SITTER_VIM9_PARSE_FILE
+#include "index.h"
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+typedef struct {
+    char *path;
+    bool root;  // 命令行上直接给出的文件不看扩展名
+} Task;
+
+// 环形缓冲区，满了翻倍
+typedef struct {
+    pthread_mutex_t lock;
+    Task *tasks;
+    size_t head;
+    size_t count;
+    size_t capacity;
+} Deque;
+
+typedef struct Pool Pool;
+
+typedef struct {
+    Pool *pool;
+    unsigned id;
+    Deque deque;
+    TSParser *parser;
+    TreeSitterVim9Arena *arena;
+    IndexBuffer out;
+    IndexStats stats;
+    bool memory;
+} Worker;
+
+struct Pool {
+    Worker *workers;
+    unsigned count;
+    IndexSymbols symbols;
+    // 已入队但还没处理完的任务数，归零即全部完成
+    atomic_size_t pending;
+    pthread_mutex_t output_lock;
+};
+
+static void deque_push(Deque *d, Task task) {
+    pthread_mutex_lock(&d->lock);
+    if (d->count == d->capacity) {
+        size_t capacity = d->capacity ? d->capacity * 2 : 64;
+        Task *tasks = malloc(capacity * sizeof(Task));
+        for (size_t i = 0; i < d->count; i++) {
+            tasks[i] = d->tasks[(d->head + i) % d->capacity];
+        }
+        free(d->tasks);
+        d->tasks = tasks;
+        d->head = 0;
+        d->capacity = capacity;
+    }
+    d->tasks[(d->head + d->count) % d->capacity] = task;
+    d->count++;
+    pthread_mutex_unlock(&d->lock);
+}
+
+static bool deque_pop_back(Deque *d, Task *task) {
+    pthread_mutex_lock(&d->lock);
+    bool ok = d->count > 0;
+    if (ok) {
+        d->count--;
+        *task = d->tasks[(d->head + d->count) % d->capacity];
+    }
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static bool deque_pop_front(Deque *d, Task *task) {
+    // 别人正在用的队列不等，换下一个去偷
+    if (pthread_mutex_trylock(&d->lock) != 0) {
+        return false;
+    }
+    bool ok = d->count > 0;
+    if (ok) {
+        *task = d->tasks[d->head];
+        d->head = (d->head + 1) % d->capacity;
+        d->count--;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static void submit(Worker *worker, char *path, bool root) {
+    atomic_fetch_add(&worker->pool->pending, 1);
+    deque_push(&worker->deque, (Task){path, root});
+}
+
+static bool has_suffix(const char *s, const char *suffix) {
+    size_t n = strlen(s), m = strlen(suffix);
+    return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+static void walk_dir(Worker *worker, const char *path) {
+    DIR *dir = opendir(path);
+    if (!dir) {
+        perror(path);
+        worker->stats.failed++;
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        size_t length = strlen(path) + strlen(entry->d_name) + 2;
+        char *child = malloc(length);
+        snprintf(child, length, "%s/%s", path, entry->d_name);
+        submit(worker, child, false);
+    }
+    closedir(dir);
+}
+
+// 直接在 mmap 上解析，名字也从映射里切，不复制文件内容
+static void index_file(Worker *worker, const char *path) {
+    TSParser *parser = worker->parser;
+    if (worker->arena) {
+        tree_sitter_vim9_arena_enter(worker->arena);
+        parser = ts_parser_new();
+        if (!ts_parser_set_language(parser, tree_sitter_vim9())) {
+            fprintf(stderr, "%s: incompatible tree-sitter runtime\n", path);
+            worker->stats.failed++;
+            ts_parser_delete(parser);
+            tree_sitter_vim9_arena_enter(NULL);
+            tree_sitter_vim9_arena_reset(worker->arena);
+            return;
+        }
+    }
+    TreeSitterVim9File file;
+    TSTree *tree = tree_sitter_vim9_parse_file_mapped(parser, path, &file);
+    if (tree) {
+        worker->out.length = 0;
+        index_extract(&worker->pool->symbols, tree, path, file.data, file.length, &worker->out);
+        worker->stats.files++;
+        worker->stats.bytes += file.length;
+        worker->stats.error_files += ts_node_has_error(ts_tree_root_node(tree));
+        if (worker->memory && !tree_sitter_vim9_footprint_add(&worker->stats.footprint, tree)) {
+            fprintf(stderr, "%s: out of memory\n", path);
+            worker->stats.failed++;
+        }
+        tree_sitter_vim9_file_close(&file);
+    } else {
+        perror(path);
+        worker->stats.failed++;
+    }
+    if (tree) {
+        ts_tree_delete(tree);
+    }
+    if (worker->arena) {
+        // 扫描器状态可能来自 libc，reset 之前先删 parser
+        ts_parser_delete(parser);
+        tree_sitter_vim9_arena_enter(NULL);
+        tree_sitter_vim9_arena_reset(worker->arena);
+    }
+    if (!tree) {
+        return;
+    }
+
+    // 一个文件的记录整体写出，行不会和别的线程交错
+    pthread_mutex_lock(&worker->pool->output_lock);
+    fwrite(worker->out.data, 1, worker->out.length, stdout);
+    pthread_mutex_unlock(&worker->pool->output_lock);
+}
+
+static void run_task(Worker *worker, Task task) {
+    struct stat st;
+    if (stat(task.path, &st) != 0) {
+        perror(task.path);
+        worker->stats.failed++;
+    } else if (S_ISDIR(st.st_mode)) {
+        walk_dir(worker, task.path);
+    } else if (S_ISREG(st.st_mode) && (task.root || has_suffix(task.path, ".vim"))) {
+        index_file(worker, task.path);
+    }
+    free(task.path);
+}
+
+static bool steal(Worker *worker, Task *task) {
+    Pool *pool = worker->pool;
+    for (unsigned i = 1; i < pool->count; i++) {
+        Worker *victim = &pool->workers[(worker->id + i) % pool->count];
+        if (deque_pop_front(&victim->deque, task)) {
+            worker->stats.steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void *worker_main(void *arg) {
+    Worker *worker = arg;
+    Pool *pool = worker->pool;
+    for (;;) {
+        Task task;
+        if (deque_pop_back(&worker->deque, &task) || steal(worker, &task)) {
+            run_task(worker, task);
+            atomic_fetch_sub(&pool->pending, 1);
+        } else if (atomic_load(&pool->pending) == 0) {
+            return NULL;
+        } else {
+            // 还有任务在别人手上执行，稍后可能分出新任务
+            sched_yield();
+        }
+    }
+}
+
+bool index_run(char **roots, size_t root_count, const IndexOptions *options,
+               IndexStats *stats) {
+    Pool pool = {.count = options->threads ? options->threads : 1};
+    if (!index_symbols_init(&pool.symbols, tree_sitter_vim9())) {
+        fprintf(stderr, "grammar has none of the symbols the indexer extracts\n");
+        return false;
+    }
+    if (options->arena) {
+        ts_set_allocator(tree_sitter_vim9_arena_malloc, tree_sitter_vim9_arena_calloc,
+                         tree_sitter_vim9_arena_realloc, tree_sitter_vim9_arena_free);
+    }
+    atomic_init(&pool.pending, 0);
+    pthread_mutex_init(&pool.output_lock, NULL);
+    pool.workers = calloc(pool.count, sizeof(Worker));
+
+    bool ok = true;
+    for (unsigned i = 0; i < pool.count; i++) {
+        Worker *worker = &pool.workers[i];
+        worker->pool = &pool;
+        worker->id = i;
+        pthread_mutex_init(&worker->deque.lock, NULL);
+        worker->parser = ts_parser_new();
+        worker->arena = options->arena ? tree_sitter_vim9_arena_new(0) : NULL;
+        worker->memory = options->memory;
+        if (ok && !ts_parser_set_language(worker->parser, tree_sitter_vim9())) {
+            fprintf(stderr, "incompatible tree-sitter runtime\n");
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        // 根路径都放进 0 号队列，其余 worker 一开始就靠偷
+        for (size_t i = 0; i < root_count; i++) {
+            submit(&pool.workers[0], strdup(roots[i]), true);
+        }
+        pthread_t *threads = calloc(pool.count, sizeof(pthread_t));
+        unsigned started = 1;
+        for (; started < pool.count; started++) {
+            if (pthread_create(&threads[started], NULL, worker_main,
+                               &pool.workers[started]) != 0) {
+                break;
+            }
+        }
+        // 调用线程就是 0 号 worker
+        worker_main(&pool.workers[0]);
+        for (unsigned i = 1; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        free(threads);
+    }
+
+    *stats = (IndexStats){0};
+    for (unsigned i = 0; i < pool.count; i++) {
+        Worker *worker = &pool.workers[i];
+        stats->files += worker->stats.files;
+        stats->bytes += worker->stats.bytes;
+        stats->error_files += worker->stats.error_files;
+        stats->failed += worker->stats.failed;
+        stats->steals += worker->stats.steals;
+        if (!tree_sitter_vim9_footprint_merge(&stats->footprint, &worker->stats.footprint)) {
+            fprintf(stderr, "out of memory\n");
+            stats->failed++;
+        }
+        tree_sitter_vim9_footprint_free(&worker->stats.footprint);
+        ts_parser_delete(worker->parser);
+        tree_sitter_vim9_arena_delete(worker->arena);
+        free(worker->deque.tasks);
+        free(worker->out.data);
+        pthread_mutex_destroy(&worker->deque.lock);
+    }
+    free(pool.workers);
+    pthread_mutex_destroy(&pool.output_lock);
+    return ok && stats->failed == 0;
+}
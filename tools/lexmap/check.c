@@ -0,0 +1,208 @@
+// check.c
+// ctest 用：确认 vim9-lexmap 改写后的词法器和原来的 ADVANCE_MAP 写法等价。
+// 库里的 tree_sitter_vim9() 用的是查表版 src/parser.c，tree_sitter_vim9_linear() 是
+// vim9-lexmap --restore 还原出来的线性查找版。对每个文件的每个字符位置、每个会用到的
+// lex state（以及关键字词法器）各跑一次两边的 lex 函数，比较返回值、token、token 结尾
+// 和读到的位置。
+// 用法：vim9-lexmap-check file.vim...
+
+#include "tree_sitter/parser.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const TSLanguage *tree_sitter_vim9(void);
+const TSLanguage *tree_sitter_vim9_linear(void);
+
+// 模拟运行时的 TSLexer：按 UTF-8 解码，文件末尾 lookahead 为 0
+typedef struct {
+    TSLexer lexer;
+    const char *data;
+    uint32_t length;
+    uint32_t position;
+    uint32_t size;  // 当前 lookahead 占的字节数
+    uint32_t marked;
+    bool has_mark;
+    uint32_t steps;
+} FakeLexer;
+
+typedef struct {
+    bool result;
+    TSSymbol symbol;
+    uint32_t end;
+    uint32_t position;
+} LexResult;
+
+// 防止两边都原地打转时卡住
+#define MAX_STEPS (1u << 20)
+
+static void decode(FakeLexer *self) {
+    const unsigned char *s = (const unsigned char *)self->data + self->position;
+    uint32_t left = self->length - self->position;
+    if (left == 0) {
+        self->lexer.lookahead = 0;
+        self->size = 0;
+        return;
+    }
+    uint32_t size = s[0] < 0x80 ? 1 : s[0] >= 0xf0 ? 4 : s[0] >= 0xe0 ? 3 : s[0] >= 0xc0 ? 2 : 0;
+    if (size == 0 || size > left) {
+        self->lexer.lookahead = 0xfffd;
+        self->size = 1;
+        return;
+    }
+    int32_t code = size == 1 ? s[0] : s[0] & (0x7f >> size);
+    for (uint32_t i = 1; i < size; i++) {
+        if ((s[i] & 0xc0) != 0x80) {
+            self->lexer.lookahead = 0xfffd;
+            self->size = 1;
+            return;
+        }
+        code = (code << 6) | (s[i] & 0x3f);
+    }
+    self->lexer.lookahead = code;
+    self->size = size;
+}
+
+static void fake_advance(TSLexer *lexer, bool skip) {
+    (void)skip;
+    FakeLexer *self = (FakeLexer *)lexer;
+    self->steps++;
+    if (self->position < self->length && self->steps < MAX_STEPS) {
+        self->position += self->size;
+        decode(self);
+    }
+}
+
+static void fake_mark_end(TSLexer *lexer) {
+    FakeLexer *self = (FakeLexer *)lexer;
+    self->marked = self->position;
+    self->has_mark = true;
+}
+
+static uint32_t fake_get_column(TSLexer *lexer) {
+    FakeLexer *self = (FakeLexer *)lexer;
+    uint32_t column = 0;
+    for (uint32_t i = self->position; i > 0 && self->data[i - 1] != '\n'; i--) {
+        column++;
+    }
+    return column;
+}
+
+static bool fake_is_at_included_range_start(const TSLexer *lexer) {
+    (void)lexer;
+    return false;
+}
+
+static bool fake_eof(const TSLexer *lexer) {
+    const FakeLexer *self = (const FakeLexer *)lexer;
+    return self->position >= self->length;
+}
+
+static void fake_log(const TSLexer *lexer, const char *format, ...) {
+    (void)lexer;
+    (void)format;
+}
+
+static LexResult run(bool (*lex)(TSLexer *, TSStateId), TSStateId state, const char *data,
+                     uint32_t length, uint32_t start) {
+    FakeLexer self = {
+        .lexer = {0, 0, fake_advance, fake_mark_end, fake_get_column,
+                  fake_is_at_included_range_start, fake_eof, fake_log},
+        .data = data,
+        .length = length,
+        .position = start,
+    };
+    decode(&self);
+    bool result = lex(&self.lexer, state);
+    return (LexResult){result, result ? self.lexer.result_symbol : 0,
+                       self.has_mark ? self.marked : self.position, self.position};
+}
+
+static char *read_file(const char *path, uint32_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc((size_t)size + 1);
+    *length = (uint32_t)fread(data, 1, (size_t)size, file);
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s file.vim...\n", argv[0]);
+        return 2;
+    }
+    const TSLanguage *dense = tree_sitter_vim9(), *linear = tree_sitter_vim9_linear();
+    if (dense->state_count != linear->state_count) {
+        fprintf(stderr, "the two parsers come from different grammars\n");
+        return 1;
+    }
+
+    // 解析过程中 ts_lex 只会从 lex_modes 里出现过的 state 起步
+    bool *used = calloc(UINT16_MAX + 1, sizeof(bool));
+    TSStateId *states = malloc((UINT16_MAX + 1) * sizeof(TSStateId));
+    uint32_t state_count = 0;
+    for (uint32_t i = 0; i < dense->state_count; i++) {
+        uint16_t state = dense->lex_modes[i].lex_state;
+        if (state != UINT16_MAX && !used[state]) {
+            used[state] = true;
+            states[state_count++] = state;
+        }
+    }
+
+    uint64_t calls = 0, mismatches = 0;
+    for (int f = 1; f < argc; f++) {
+        uint32_t length;
+        char *data = read_file(argv[f], &length);
+        if (!data) {
+            return 1;
+        }
+        for (uint32_t start = 0; start <= length; start++) {
+            // 只从字符边界起步
+            if (start < length && ((unsigned char)data[start] & 0xc0) == 0x80) {
+                continue;
+            }
+            for (uint32_t i = 0; i <= state_count; i++) {
+                bool keywords = i == state_count;
+                if (keywords && !dense->keyword_lex_fn) {
+                    break;
+                }
+                TSStateId state = keywords ? 0 : states[i];
+                LexResult a = run(keywords ? dense->keyword_lex_fn : dense->lex_fn, state, data,
+                                  length, start);
+                LexResult b = run(keywords ? linear->keyword_lex_fn : linear->lex_fn, state, data,
+                                  length, start);
+                calls++;
+                if (a.result != b.result || a.symbol != b.symbol || a.end != b.end ||
+                    a.position != b.position) {
+                    if (mismatches++ < 10) {
+                        fprintf(stderr,
+                                "%s:%u: %s state %u: table lexer gave (%d, %u, %u), "
+                                "ADVANCE_MAP (%d, %u, %u)\n",
+                                argv[f], start, keywords ? "keyword" : "lex", state, a.result,
+                                a.symbol, a.end, b.result, b.symbol, b.end);
+                    }
+                }
+            }
+        }
+        free(data);
+    }
+    free(used);
+    free(states);
+    if (mismatches) {
+        fprintf(stderr, "%llu of %llu lex calls differ\n", (unsigned long long)mismatches,
+                (unsigned long long)calls);
+        return 1;
+    }
+    printf("%llu lex calls over %u lex states agree\n", (unsigned long long)calls, state_count);
+    return 0;
+}
@@ -0,0 +1,460 @@
+// lexmap.c
+// tree-sitter generate 之后的后处理：把 src/parser.c 里较大的 ADVANCE_MAP（逐对线性比较）
+// 改写成按 ASCII 下标的 128 项查表，lookahead < 128 时一次取数即可；非 ASCII 的键留在
+// 后面一个小 ADVANCE_MAP 里。表项存 state + 1，0 表示没有这一项；state 都小于 255 时用 uint8_t。
+// 查表写成 ADVANCE_TABLE(map)，默认定义插在 parser.h 的 include 之后，
+// bindings/c/profile.c 换成计数的版本，和它对 ADVANCE_MAP 的处理一样。
+// --restore 把查表还原成等价的 ADVANCE_MAP，供 vim9-lexmap-check 对比两种写法。
+// --stats 只统计不改写：文件大小、两个词法函数的行数和 state 数、lex mode 的种类等，
+// 用来对比语法改动（例如 word 关键字提取）前后生成的 parser.c。
+// 用法：vim9-lexmap [--min N] [--restore | --stats] input.c [output.c]，不给 output 就原地改写
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MARKER "// vim9-lexmap: dense ADVANCE_MAP, entries hold state + 1"
+#define DENSE_SIZE 128
+#define PARSER_INCLUDE "#include \"tree_sitter/parser.h\"\n"
+
+// 插在 PARSER_INCLUDE 之后；--restore 时去掉
+static const char table_macro[] =
+    "\n"
+    "// vim9-lexmap: lookup in a dense table, entries hold state + 1\n"
+    "#ifndef ADVANCE_TABLE\n"
+    "#define ADVANCE_TABLE(map)                           \\\n"
+    "  {                                                  \\\n"
+    "    if (map[lookahead]) ADVANCE(map[lookahead] - 1); \\\n"
+    "  }\n"
+    "#endif\n";
+
+typedef struct {
+    long key;
+    long state;
+} Pair;
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} Buffer;
+
+static void append(Buffer *buffer, const char *data, size_t length) {
+    if (buffer->length + length + 1 > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 1 << 16;
+        while (buffer->length + length + 1 > capacity) {
+            capacity *= 2;
+        }
+        buffer->data = realloc(buffer->data, capacity);
+        if (!buffer->data) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        buffer->capacity = capacity;
+    }
+    memcpy(buffer->data + buffer->length, data, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+static void appendf(Buffer *buffer, const char *format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    append(buffer, line, (size_t)length);
+}
+
+static char *read_file(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc((size_t)size + 1);
+    *length = fread(data, 1, (size_t)size, file);
+    fclose(file);
+    data[*length] = '\0';
+    return data;
+}
+
+// 'a'、'\n'、'\''、'\\' 这样的字符字面量或十进制/十六进制整数；失败返回 NULL
+static const char *parse_key(const char *p, long *key) {
+    if (*p == '\'') {
+        p++;
+        if (*p == '\\') {
+            p++;
+            switch (*p) {
+                case 'n': *key = '\n'; break;
+                case 't': *key = '\t'; break;
+                case 'r': *key = '\r'; break;
+                case 'f': *key = '\f'; break;
+                case 'v': *key = '\v'; break;
+                case 'b': *key = '\b'; break;
+                case '0': *key = 0; break;
+                case '\\': *key = '\\'; break;
+                case '\'': *key = '\''; break;
+                case '"': *key = '"'; break;
+                default: return NULL;
+            }
+        } else if (*p && *p != '\'' && (unsigned char)*p < 0x80) {
+            *key = (unsigned char)*p;
+        } else {
+            return NULL;
+        }
+        p++;
+        return *p == '\'' ? p + 1 : NULL;
+    }
+    if (!isdigit((unsigned char)*p)) {
+        return NULL;
+    }
+    char *end;
+    *key = strtol(p, &end, 0);
+    return end;
+}
+
+static void format_key(char *out, size_t size, long key) {
+    switch (key) {
+        case '\n': snprintf(out, size, "'\\n'"); return;
+        case '\t': snprintf(out, size, "'\\t'"); return;
+        case '\r': snprintf(out, size, "'\\r'"); return;
+        case '\f': snprintf(out, size, "'\\f'"); return;
+        case '\v': snprintf(out, size, "'\\v'"); return;
+        case '\b': snprintf(out, size, "'\\b'"); return;
+        case 0: snprintf(out, size, "'\\0'"); return;
+        case '\\': snprintf(out, size, "'\\\\'"); return;
+        case '\'': snprintf(out, size, "'\\''"); return;
+        default:
+            if (key > 0x20 && key < 0x7f) {
+                snprintf(out, size, "'%c'", (char)key);
+            } else {
+                snprintf(out, size, "%ld", key);
+            }
+    }
+}
+
+// 从行首 p 开始读 "KEY, STATE," 这样的行直到 "<indent>);"；返回结尾那一行之后的位置
+static const char *parse_pairs(const char *p, const char *indent, size_t indent_length,
+                               Pair **pairs, size_t *count) {
+    *count = 0;
+    for (;;) {
+        const char *line = p;
+        while (*p == ' ') {
+            p++;
+        }
+        if ((size_t)(p - line) == indent_length && strncmp(line, indent, indent_length) == 0 &&
+            strncmp(p, ");\n", 3) == 0) {
+            return p + 3;
+        }
+        Pair pair;
+        p = parse_key(p, &pair.key);
+        if (!p || strncmp(p, ", ", 2) != 0 || !isdigit((unsigned char)p[2])) {
+            return NULL;
+        }
+        char *end;
+        pair.state = strtol(p + 2, &end, 10);
+        if (strncmp(end, ",\n", 2) != 0) {
+            return NULL;
+        }
+        p = end + 2;
+        *pairs = realloc(*pairs, (*count + 1) * sizeof(Pair));
+        (*pairs)[(*count)++] = pair;
+    }
+}
+
+static void emit_map(Buffer *out, const char *indent, const Pair *pairs, size_t count) {
+    char key[16];
+    appendf(out, "%sADVANCE_MAP(\n", indent);
+    for (size_t i = 0; i < count; i++) {
+        format_key(key, sizeof(key), pairs[i].key);
+        appendf(out, "%s  %s, %ld,\n", indent, key, pairs[i].state);
+    }
+    appendf(out, "%s);\n", indent);
+}
+
+// 同一个键以先出现的为准，和线性查找一致
+static bool emit_dense(Buffer *out, const char *indent, const Pair *pairs, size_t count) {
+    long dense[DENSE_SIZE] = {0};
+    long max_state = 0;
+    Pair *rest = malloc((count ? count : 1) * sizeof(Pair));
+    size_t rest_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (pairs[i].state >= UINT16_MAX || pairs[i].key < 0) {
+            free(rest);
+            return false;
+        }
+        if (pairs[i].key < DENSE_SIZE) {
+            if (!dense[pairs[i].key]) {
+                dense[pairs[i].key] = pairs[i].state + 1;
+            }
+        } else {
+            rest[rest_count++] = pairs[i];
+        }
+        if (pairs[i].state > max_state) {
+            max_state = pairs[i].state;
+        }
+    }
+    appendf(out, "%s" MARKER "\n", indent);
+    appendf(out, "%sif ((uint32_t)lookahead < %d) {\n", indent, DENSE_SIZE);
+    appendf(out, "%s  static const %s map[%d] = {\n", indent,
+            max_state + 1 <= UINT8_MAX ? "uint8_t" : "uint16_t", DENSE_SIZE);
+    char key[16];
+    for (long i = 0; i < DENSE_SIZE; i++) {
+        if (dense[i]) {
+            format_key(key, sizeof(key), i);
+            appendf(out, "%s    [%s] = %ld,\n", indent, key, dense[i]);
+        }
+    }
+    appendf(out, "%s  };\n", indent);
+    appendf(out, "%s  ADVANCE_TABLE(map);\n", indent);
+    appendf(out, "%s}\n", indent);
+    if (rest_count > 0) {
+        emit_map(out, indent, rest, rest_count);
+    }
+    free(rest);
+    return true;
+}
+
+// 读回 emit_dense 写出的 "[KEY] = STATE + 1," 各行，p 指向 "static const" 那一行之后
+static const char *parse_dense(const char *p, Pair **pairs, size_t *count) {
+    *count = 0;
+    for (;;) {
+        while (*p == ' ') {
+            p++;
+        }
+        if (strncmp(p, "};\n", 3) == 0) {
+            p += 3;
+            break;
+        }
+        Pair pair;
+        if (*p != '[' || !(p = parse_key(p + 1, &pair.key)) || strncmp(p, "] = ", 4) != 0) {
+            return NULL;
+        }
+        char *end;
+        pair.state = strtol(p + 4, &end, 10) - 1;
+        if (strncmp(end, ",\n", 2) != 0) {
+            return NULL;
+        }
+        p = end + 2;
+        *pairs = realloc(*pairs, (*count + 1) * sizeof(Pair));
+        (*pairs)[(*count)++] = pair;
+    }
+    // 查表那一行和收尾的 "}"
+    for (int lines = 0; lines < 2; lines++) {
+        p = strchr(p, '\n');
+        if (!p) {
+            return NULL;
+        }
+        p++;
+    }
+    return p;
+}
+
+// 从 "static bool <name>(" 数到函数结尾的 "}"：行数和 "    case N:" 的个数
+static void function_stats(const char *data, const char *name, size_t *lines, size_t *states) {
+    *lines = *states = 0;
+    char signature[64];
+    snprintf(signature, sizeof(signature), "\nstatic bool %s(", name);
+    const char *p = strstr(data, signature);
+    if (!p) {
+        return;
+    }
+    for (p++; *p; p++) {
+        const char *end = strchr(p, '\n');
+        if (!end) {
+            break;
+        }
+        (*lines)++;
+        if (strncmp(p, "    case ", 9) == 0 && isdigit((unsigned char)p[9])) {
+            (*states)++;
+        }
+        if (strncmp(p, "}\n", 2) == 0) {
+            break;
+        }
+        p = end;
+    }
+}
+
+static size_t count_occurrences(const char *data, const char *needle) {
+    size_t count = 0;
+    for (const char *p = data; (p = strstr(p, needle)); p += strlen(needle)) {
+        count++;
+    }
+    return count;
+}
+
+static void print_stats(const char *path, const char *data, size_t length) {
+    size_t lines = count_occurrences(data, "\n");
+    size_t lex_lines, lex_states, keyword_lines, keyword_states;
+    function_stats(data, "ts_lex", &lex_lines, &lex_states);
+    function_stats(data, "ts_lex_keywords", &keyword_lines, &keyword_states);
+
+    // ts_lex_modes 的每一项是 "[N] = {...}," 一行，按 {...} 的内容去重
+    size_t state_count = 0, modes = 0;
+    char **seen = NULL;
+    const char *p = strstr(data, "ts_lex_modes[STATE_COUNT] = {\n");
+    for (p = p ? strchr(p, '\n') + 1 : NULL; p && strncmp(p, "};", 2) != 0;) {
+        const char *end = strchr(p, '\n');
+        const char *mode = strstr(p, "= {");
+        if (!end) {
+            break;
+        }
+        if (mode && mode < end) {
+            size_t size = (size_t)(end - mode);
+            bool found = false;
+            for (size_t i = 0; i < modes && !found; i++) {
+                found = strlen(seen[i]) == size && strncmp(seen[i], mode, size) == 0;
+            }
+            if (!found) {
+                seen = realloc(seen, (modes + 1) * sizeof(char *));
+                seen[modes] = malloc(size + 1);
+                memcpy(seen[modes], mode, size);
+                seen[modes++][size] = '\0';
+            }
+            state_count++;
+        }
+        p = end + 1;
+    }
+    for (size_t i = 0; i < modes; i++) {
+        free(seen[i]);
+    }
+    free(seen);
+
+    printf("%s\n", path);
+    printf("  size:             %zu bytes, %zu lines\n", length, lines);
+    printf("  ts_lex:           %zu lines, %zu states\n", lex_lines, lex_states);
+    printf("  ts_lex_keywords:  %zu lines, %zu states\n", keyword_lines, keyword_states);
+    printf("  parse states:     %zu, %zu distinct lex modes\n", state_count, modes);
+    printf("  ADVANCE_MAP:      %zu, dense tables %zu\n",
+           count_occurrences(data, "ADVANCE_MAP(\n"), count_occurrences(data, MARKER "\n"));
+}
+
+int main(int argc, char **argv) {
+    size_t min_entries = 16;
+    bool restore = false, stats = false;
+    const char *input = NULL, *output = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--min") == 0 && i + 1 < argc) {
+            min_entries = (size_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--restore") == 0) {
+            restore = true;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats = true;
+        } else if (argv[i][0] != '-' && !input) {
+            input = argv[i];
+        } else if (argv[i][0] != '-' && !output) {
+            output = argv[i];
+        } else {
+            input = NULL;
+            break;
+        }
+    }
+    if (!input) {
+        fprintf(stderr, "usage: %s [--min N] [--restore | --stats] input.c [output.c]\n", argv[0]);
+        return 2;
+    }
+    if (!output) {
+        output = input;
+    }
+
+    size_t length;
+    char *data = read_file(input, &length);
+    if (!data) {
+        return 1;
+    }
+    if (stats) {
+        print_stats(input, data, length);
+        free(data);
+        return 0;
+    }
+    Buffer out = {0};
+    Pair *pairs = NULL;
+    size_t count, rewritten = 0;
+    const char *p = data;
+    const char *macro = strstr(data, table_macro);
+    const char *include = strstr(data, PARSER_INCLUDE);
+    if (restore && macro) {
+        append(&out, data, (size_t)(macro - data));
+        p = macro + strlen(table_macro);
+    } else if (!restore && !macro && include) {
+        p = include + strlen(PARSER_INCLUDE);
+        append(&out, data, (size_t)(p - data));
+        append(&out, table_macro, strlen(table_macro));
+    }
+    const char *needle = restore ? MARKER "\n" : "ADVANCE_MAP(\n";
+    for (const char *found; (found = strstr(p, needle));) {
+        // 只认行首缩进后的出现
+        const char *line = found;
+        while (line > data && line[-1] == ' ') {
+            line--;
+        }
+        if (line > data && line[-1] != '\n') {
+            append(&out, p, (size_t)(found + strlen(needle) - p));
+            p = found + strlen(needle);
+            continue;
+        }
+        char indent[64];
+        size_t indent_length = (size_t)(found - line);
+        if (indent_length >= sizeof(indent)) {
+            indent_length = sizeof(indent) - 1;
+        }
+        memcpy(indent, line, indent_length);
+        indent[indent_length] = '\0';
+        append(&out, p, (size_t)(line - p));
+
+        const char *end = NULL;
+        if (restore) {
+            // 标记之后是 "if (...) {" 和 "static const ... map[128] = {" 两行
+            const char *body = found + strlen(needle);
+            for (int lines = 0; body && lines < 2; lines++) {
+                body = strchr(body, '\n');
+                body = body ? body + 1 : NULL;
+            }
+            end = body ? parse_dense(body, &pairs, &count) : NULL;
+            if (end) {
+                emit_map(&out, indent, pairs, count);
+            }
+        } else {
+            end = parse_pairs(found + strlen(needle), indent, indent_length, &pairs, &count);
+            if (end && (count < min_entries || !emit_dense(&out, indent, pairs, count))) {
+                end = NULL;
+            }
+        }
+        if (!end) {
+            // 认不出的或太小的原样保留
+            end = found + strlen(needle);
+            append(&out, line, (size_t)(end - line));
+        } else {
+            rewritten++;
+        }
+        p = end;
+    }
+    append(&out, p, length - (size_t)(p - data));
+
+    // 先写临时文件再改名，失败时不会留下半个 parser.c
+    size_t path_length = strlen(output) + 5;
+    char *temporary = malloc(path_length);
+    snprintf(temporary, path_length, "%s.tmp", output);
+    FILE *file = fopen(temporary, "wb");
+    if (!file || fwrite(out.data, 1, out.length, file) != out.length || fclose(file) != 0 ||
+        rename(temporary, output) != 0) {
+        perror(temporary);
+        remove(temporary);
+        return 1;
+    }
+    fprintf(stderr, "%s: %s %zu ADVANCE_MAP table(s)\n", output,
+            restore ? "restored" : "rewrote", rewritten);
+    free(temporary);
+    free(pairs);
+    free(out.data);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,191 @@
+// check.c
+// ctest 用：检查 tree_sitter_vim9_splitter_* 找的切分点。
+// 先跑一组手写用例（每个标出全部切分点），再对每个语料文件确认：
+// 逐字节喂入找到的切分点，和一次性扫描、按不同块大小像 tree-sitter-vim9-stream.h
+// 那样边读边切的结果一致。
+// 用法：vim9-split-check file.vim...
+
+#include "tree_sitter/tree-sitter-vim9.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CUTS 4096
+
+typedef struct {
+    uint32_t count;
+    uint32_t offsets[MAX_CUTS];
+} Cuts;
+
+typedef struct {
+    const char *name;
+    const char *text;
+    // 切分点所在行的行号（0 起），以 -1 结束；不含文件末尾
+    int lines[8];
+} Case;
+
+static const Case cases[] = {
+    {"statements", "var a = 1\nvar b = 2\n", {1, -1}},
+    {"def", "def F()\n  if x\n    return\n  endif\nenddef\nF()\n", {5, -1}},
+    {"legacy function", "fu! G()\nendfu\nfunction H() abort\nendfunction\n", {2, -1}},
+    {"export def", "export def F()\nenddef\nvar x = 1\n", {2, -1}},
+    {"list", "var l = [\n  1,\n  2,\n]\nvar m = 3\n", {4, -1}},
+    {"continuation", "var s = 'a'\n  .. 'b'\n  \\ 'c'\nvar t = x\n  ->F()\n", {3, -1}},
+    {"ternary", "var x = a\n  ? 1\n  : 2\n:echo x\n", {3, -1}},
+    {"dict and lambda", "var d = #{\n  a: 1}\nvar F = () => {\n  return 1\n}\ncall F()\n",
+     {2, 5, -1}},
+    {"dict at line start", "#{a: 1}->keys()\necho 1\n", {1, -1}},
+    {"brackets in strings", "var a = '[('\nvar b = \"{\\\"\"\nvar c = 1\n", {1, 2, -1}},
+    {"brackets in comments", "var a = 1 # (\n\" [\n# {\nvar b = 2\n", {1, 2, 3, -1}},
+    {"mappings", "nnoremap <leader>( :call F(<CR>\nhi Group guifg=#ff0000\nvar x = 1\n",
+     {1, 2, -1}},
+    {"names, not blocks", "func = Foo\nfu = 1\nel->add(x)\nen += 3\ndef_x = 2\nif(x)\nendif\n",
+     {1, 2, 3, 4, 5, -1}},
+    {"bar", "if x | echo 1 | endif\nfor i in l | endfor\n", {1, -1}},
+    {"heredoc", "var l =<< trim END\n  def\n  [\n  END\nvar x = 1\n", {4, -1}},
+    {"script heredoc", "lua << EOF\nlocal t = {\nEOF\npython3 <<\nx = (\n.\necho 1\n",
+     {3, 6, -1}},
+    {"crlf", "var a = 1\r\nvar b = [\r\n]\r\nvar c = 3\r\n", {1, 3, -1}},
+};
+
+// 每次只给一个字节，记下每个新的切分点
+static void collect(const char *data, uint32_t length, Cuts *cuts) {
+    TreeSitterVim9Splitter splitter;
+    tree_sitter_vim9_splitter_init(&splitter);
+    cuts->count = 0;
+    for (uint32_t n = 1; n <= length; n++) {
+        uint32_t cut = tree_sitter_vim9_splitter_scan(&splitter, data, n, false);
+        if (cut && (cuts->count == 0 || cuts->offsets[cuts->count - 1] != cut) &&
+            cuts->count < MAX_CUTS) {
+            cuts->offsets[cuts->count++] = cut;
+        }
+    }
+}
+
+static bool contains(const Cuts *cuts, uint32_t offset) {
+    for (uint32_t i = 0; i < cuts->count; i++) {
+        if (cuts->offsets[i] == offset) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t line_start(const char *text, int line) {
+    uint32_t offset = 0;
+    for (int row = 0; row < line; row++) {
+        offset = (uint32_t)(strchr(text + offset, '\n') - text) + 1;
+    }
+    return offset;
+}
+
+static bool check_case(const Case *test) {
+    uint32_t length = (uint32_t)strlen(test->text);
+    Cuts cuts;
+    collect(test->text, length, &cuts);
+    Cuts expected = {0};
+    for (int i = 0; test->lines[i] >= 0; i++) {
+        expected.offsets[expected.count++] = line_start(test->text, test->lines[i]);
+    }
+    bool ok = cuts.count == expected.count &&
+              memcmp(cuts.offsets, expected.offsets, cuts.count * sizeof(uint32_t)) == 0;
+    if (!ok) {
+        fprintf(stderr, "%s: expected cuts at byte", test->name);
+        for (uint32_t i = 0; i < expected.count; i++) {
+            fprintf(stderr, " %u", expected.offsets[i]);
+        }
+        fprintf(stderr, ", got");
+        for (uint32_t i = 0; i < cuts.count; i++) {
+            fprintf(stderr, " %u", cuts.offsets[i]);
+        }
+        fprintf(stderr, "\n");
+    }
+    return ok;
+}
+
+// 按 block 字节一块块读入，凑够 block 字节就切，和 tree_sitter_vim9_stream_next() 的节奏一样
+static bool check_stream(const char *path, const char *data, uint32_t length, const Cuts *cuts,
+                         uint32_t block) {
+    TreeSitterVim9Splitter splitter;
+    tree_sitter_vim9_splitter_init(&splitter);
+    uint32_t base = 0, end = 0;
+    while (end < length) {
+        end = end + block < length ? end + block : length;
+        uint32_t cut = tree_sitter_vim9_splitter_scan(&splitter, data + base, end - base, false);
+        if (cut == 0) {
+            continue;
+        }
+        if (!contains(cuts, base + cut)) {
+            fprintf(stderr, "%s: block %u: cut at byte %u is not a boundary\n", path, block,
+                    base + cut);
+            return false;
+        }
+        tree_sitter_vim9_splitter_consume(&splitter, cut);
+        base += cut;
+    }
+    if (tree_sitter_vim9_splitter_scan(&splitter, data + base, length - base, true) !=
+        length - base) {
+        fprintf(stderr, "%s: block %u: the end is not a cut\n", path, block);
+        return false;
+    }
+    return true;
+}
+
+static char *read_file(const char *path, uint32_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc(size > 0 ? (size_t)size : 1);
+    if (data && fread(data, 1, (size_t)size, file) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+int main(int argc, char **argv) {
+    unsigned failures = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        failures += !check_case(&cases[i]);
+    }
+
+    static const uint32_t blocks[] = {1, 7, 64, 1000, 1u << 16};
+    for (int i = 1; i < argc; i++) {
+        uint32_t length;
+        char *data = read_file(argv[i], &length);
+        if (!data) {
+            failures++;
+            continue;
+        }
+        static Cuts cuts;
+        collect(data, length, &cuts);
+        TreeSitterVim9Splitter splitter;
+        tree_sitter_vim9_splitter_init(&splitter);
+        uint32_t last = tree_sitter_vim9_splitter_scan(&splitter, data, length, false);
+        if (last != (cuts.count ? cuts.offsets[cuts.count - 1] : 0)) {
+            fprintf(stderr, "%s: one scan ends at byte %u, byte by byte at %u\n", argv[i], last,
+                    cuts.count ? cuts.offsets[cuts.count - 1] : 0);
+            failures++;
+        }
+        for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+            failures += !check_stream(argv[i], data, length, &cuts, blocks[b]);
+        }
+        printf("%s: %u bytes, %u cut(s)\n", argv[i], length, cuts.count);
+        free(data);
+    }
+    if (failures) {
+        fprintf(stderr, "%u failure(s)\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,296 @@
+// check.c
+// ctest 用：先核对 tree-sitter-vim9-symbols.h 和编译进来的语言表逐项一致（不一致说明
+// 头文件没重新生成），再和 src/node-types.json 比对类型和 field 的集合（不一致说明
+// src/parser.c 落后于语法，需要 tree-sitter generate）。两种不一致都算失败。
+// 用法：vim9-symbols-check src/node-types.json
+
+#include "tree_sitter/parser.h"
+
+#include <tree_sitter/tree-sitter-vim9-symbols.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const TSLanguage *tree_sitter_vim9(void);
+
+typedef struct {
+    const char *constant;
+    unsigned id;
+    const char *type;
+    bool named;
+} Entry;
+
+#define SYMBOL_ENTRY(constant, id, type, named) {#constant, id, type, named},
+#define FIELD_ENTRY(constant, id, name) {#constant, id, name, false},
+
+// 末尾的哨兵让列表为空时数组也合法，遍历时也以它结束
+static const Entry symbols[] = {TREE_SITTER_VIM9_SYMBOL_LIST(SYMBOL_ENTRY){NULL, 0, NULL, false}};
+static const Entry fields[] = {TREE_SITTER_VIM9_FIELD_LIST(FIELD_ENTRY){NULL, 0, NULL, false}};
+
+#define ENTRY_COUNT(entries) (sizeof(entries) / sizeof(entries[0]) - 1)
+
+static bool check_language(const TSLanguage *language) {
+    bool ok = true;
+    uint32_t symbol_count = language->symbol_count + language->alias_count;
+    if (TREE_SITTER_VIM9_SYMBOL_COUNT != symbol_count ||
+        TREE_SITTER_VIM9_FIELD_COUNT != language->field_count ||
+        TREE_SITTER_VIM9_LANGUAGE_VERSION != language->abi_version) {
+        fprintf(stderr, "symbol/field count or language version differs\n");
+        ok = false;
+    }
+    size_t public_count = 0;
+    for (TSSymbol i = 0; i < symbol_count; i++) {
+        public_count += language->symbol_metadata[i].visible && language->public_symbol_map[i] == i;
+    }
+    if (public_count != ENTRY_COUNT(symbols) || language->field_count != ENTRY_COUNT(fields)) {
+        fprintf(stderr, "header has %zu symbols and %zu fields, the language %zu and %u\n",
+                ENTRY_COUNT(symbols), ENTRY_COUNT(fields), public_count, language->field_count);
+        ok = false;
+    }
+    for (const Entry *entry = symbols; entry->constant; entry++) {
+        if (entry->id >= symbol_count || strcmp(language->symbol_names[entry->id], entry->type) ||
+            language->symbol_metadata[entry->id].named != entry->named ||
+            !language->symbol_metadata[entry->id].visible ||
+            language->public_symbol_map[entry->id] != entry->id) {
+            fprintf(stderr, "%s = %u doesn't match the language\n", entry->constant, entry->id);
+            ok = false;
+        }
+    }
+    for (const Entry *entry = fields; entry->constant; entry++) {
+        if (entry->id == 0 || entry->id > language->field_count ||
+            strcmp(language->field_names[entry->id], entry->type)) {
+            fprintf(stderr, "%s = %u doesn't match the language\n", entry->constant, entry->id);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// node-types.json 里出现的 (type, named) 和 field 名
+typedef struct {
+    Entry *items;
+    size_t count;
+} EntrySet;
+
+static bool entry_set_contains(const EntrySet *set, const char *type, bool named) {
+    for (size_t i = 0; i < set->count; i++) {
+        if (set->items[i].named == named && strcmp(set->items[i].type, type) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void entry_set_add(EntrySet *set, const char *type, bool named) {
+    if (!entry_set_contains(set, type, named)) {
+        set->items = realloc(set->items, (set->count + 1) * sizeof(Entry));
+        set->items[set->count++] = (Entry){NULL, 0, type, named};
+    }
+}
+
+// 够读 node-types.json 的最小 JSON 解析器：字符串就地解码，数字和 null 跳过
+typedef struct {
+    char *at;
+    EntrySet types;
+    EntrySet fields;
+    bool error;
+} Json;
+
+static void skip_space(Json *json) {
+    while (*json->at == ' ' || *json->at == '\n' || *json->at == '\r' || *json->at == '\t') {
+        json->at++;
+    }
+}
+
+static char *parse_string(Json *json) {
+    if (*json->at != '"') {
+        json->error = true;
+        return NULL;
+    }
+    char *start = ++json->at, *out = start;
+    while (*json->at && *json->at != '"') {
+        char c = *json->at++;
+        if (c == '\\') {
+            c = *json->at++;
+            switch (c) {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'u': {
+                    // node-types.json 只会对控制字符用 \u00XX
+                    unsigned code = 0;
+                    sscanf(json->at, "%4x", &code);
+                    json->at += 4;
+                    c = (char)code;
+                    break;
+                }
+                default: break;  // \" \\ \/
+            }
+        }
+        *out++ = c;
+    }
+    if (*json->at != '"') {
+        json->error = true;
+        return NULL;
+    }
+    json->at++;
+    *out = '\0';
+    return start;
+}
+
+static void parse_value(Json *json, const char *key);
+
+static void parse_object(Json *json, const char *key) {
+    const char *type = NULL;
+    int named = -1;
+    json->at++;
+    skip_space(json);
+    while (!json->error && *json->at != '}') {
+        char *member = parse_string(json);
+        skip_space(json);
+        if (json->error || *json->at++ != ':') {
+            json->error = true;
+            return;
+        }
+        skip_space(json);
+        if (key && strcmp(key, "fields") == 0) {
+            entry_set_add(&json->fields, member, false);
+        }
+        if (strcmp(member, "type") == 0 && *json->at == '"') {
+            type = parse_string(json);
+        } else if (strcmp(member, "named") == 0 && (*json->at == 't' || *json->at == 'f')) {
+            named = *json->at == 't';
+            json->at += named ? 4 : 5;
+        } else {
+            parse_value(json, member);
+        }
+        skip_space(json);
+        if (*json->at == ',') {
+            json->at++;
+            skip_space(json);
+        }
+    }
+    if (*json->at != '}') {
+        json->error = true;
+        return;
+    }
+    json->at++;
+    if (type && named >= 0) {
+        entry_set_add(&json->types, type, named);
+    }
+}
+
+static void parse_value(Json *json, const char *key) {
+    skip_space(json);
+    switch (*json->at) {
+        case '{':
+            parse_object(json, key);
+            break;
+        case '[':
+            json->at++;
+            skip_space(json);
+            while (!json->error && *json->at != ']') {
+                parse_value(json, key);
+                skip_space(json);
+                if (*json->at == ',') {
+                    json->at++;
+                } else if (*json->at != ']') {
+                    json->error = true;
+                }
+            }
+            json->at++;
+            break;
+        case '"':
+            parse_string(json);
+            break;
+        case '\0':
+            json->error = true;
+            break;
+        default:
+            while (*json->at && !strchr(",]}", *json->at)) {
+                json->at++;
+            }
+    }
+}
+
+static char *read_file(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = malloc((size_t)length + 1);
+    size_t read = fread(data, 1, (size_t)length, file);
+    fclose(file);
+    data[read] = '\0';
+    return data;
+}
+
+// 两边各缺了什么；返回有没有差异
+static bool report_difference(const char *what, const Entry *entries, size_t count,
+                              const EntrySet *node_types, bool fields) {
+    bool differs = false;
+    EntrySet header = {0};
+    for (size_t i = 0; i < count; i++) {
+        entry_set_add(&header, entries[i].type, entries[i].named);
+        if (!entry_set_contains(node_types, entries[i].type, entries[i].named)) {
+            fprintf(stderr, "%s %s (\"%s\") is not in node-types.json\n", what,
+                    entries[i].constant, entries[i].type);
+            differs = true;
+        }
+    }
+    for (size_t i = 0; i < node_types->count; i++) {
+        const Entry *entry = &node_types->items[i];
+        // 以 _ 开头的是 supertype，ts_node_symbol() 不会返回
+        if (!fields && entry->type[0] == '_') {
+            continue;
+        }
+        if (!entry_set_contains(&header, entry->type, entry->named)) {
+            fprintf(stderr, "node-types.json %s \"%s\"%s has no constant\n", what, entry->type,
+                    fields || entry->named ? "" : " (anonymous)");
+            differs = true;
+        }
+    }
+    free(header.items);
+    return differs;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s src/node-types.json\n", argv[0]);
+        return 2;
+    }
+    if (!check_language(tree_sitter_vim9())) {
+        fprintf(stderr, "tree-sitter-vim9-symbols.h is stale; run `make symbols`\n");
+        return 1;
+    }
+
+    char *data = read_file(argv[1]);
+    if (!data) {
+        return 1;
+    }
+    Json json = {.at = data};
+    parse_value(&json, NULL);
+    if (json.error) {
+        fprintf(stderr, "%s: malformed JSON\n", argv[1]);
+        return 1;
+    }
+    bool differs = report_difference("type", symbols, ENTRY_COUNT(symbols), &json.types, false);
+    differs |= report_difference("field", fields, ENTRY_COUNT(fields), &json.fields, true);
+    free(json.types.items);
+    free(json.fields.items);
+    free(data);
+    if (differs) {
+        fprintf(stderr, "src/parser.c does not match %s; regenerate it with `tree-sitter generate`"
+                        " and then `make symbols`\n",
+                argv[1]);
+        return 1;
+    }
+    printf("tree-sitter-vim9-symbols.h matches the language and %s\n", argv[1]);
+    return 0;
+}
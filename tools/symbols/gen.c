@@ -0,0 +1,222 @@
+// gen.c
+// 从编译进来的语言表（src/parser.c）生成 bindings/c/tree_sitter/tree-sitter-vim9-symbols.h：
+// ts_node_symbol() 能返回的每个公开 symbol 和每个 field 各一个常量。
+// 用法：vim9-symbols-gen [输出文件]，不给就写到 stdout
+// （make symbols / cmake --build <dir> --target symbols 会直接覆盖仓库里的头文件）
+
+#include "tree_sitter/parser.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const TSLanguage *tree_sitter_vim9(void);
+
+// 与 tree-sitter generate 给 anon_sym_* 起名的规则一致
+static const char *punctuation_name(char c) {
+    switch (c) {
+        case '~': return "TILDE";
+        case '`': return "BQUOTE";
+        case '!': return "BANG";
+        case '@': return "AT";
+        case '#': return "POUND";
+        case '$': return "DOLLAR";
+        case '%': return "PERCENT";
+        case '^': return "CARET";
+        case '&': return "AMP";
+        case '*': return "STAR";
+        case '(': return "LPAREN";
+        case ')': return "RPAREN";
+        case '-': return "DASH";
+        case '+': return "PLUS";
+        case '=': return "EQ";
+        case '{': return "LBRACE";
+        case '}': return "RBRACE";
+        case '[': return "LBRACK";
+        case ']': return "RBRACK";
+        case '\\': return "BSLASH";
+        case '|': return "PIPE";
+        case ':': return "COLON";
+        case ';': return "SEMI";
+        case '"': return "DQUOTE";
+        case '\'': return "SQUOTE";
+        case '<': return "LT";
+        case '>': return "GT";
+        case ',': return "COMMA";
+        case '.': return "DOT";
+        case '?': return "QMARK";
+        case '/': return "SLASH";
+        case '\n': return "LF";
+        case '\r': return "CR";
+        case '\t': return "TAB";
+        case ' ': return "SPACE";
+        default: return NULL;
+    }
+}
+
+static bool is_word(char c) {
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+typedef struct {
+    char **names;
+    size_t count;
+} NameSet;
+
+static bool name_taken(const NameSet *set, const char *name) {
+    for (size_t i = 0; i < set->count; i++) {
+        if (strcmp(set->names[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 常量名：前缀 + 大写的类型名，标点换成单词并用 _ 隔开（"!=#" -> BANG_EQ_POUND）；
+// 重名时加 _2、_3…
+static char *constant_name(NameSet *set, const char *prefix, const char *type) {
+    size_t capacity = strlen(prefix) + strlen(type) * 8 + 16;
+    char *name = malloc(capacity);
+    size_t start = (size_t)snprintf(name, capacity, "%s", prefix);
+    size_t length = start;
+    for (const char *p = type; *p; p++) {
+        unsigned char c = (unsigned char)*p;
+        // 单词内部不加分隔符，其余每段之间一个 _
+        if (length > start && !(is_word(*p) && is_word(p[-1]))) {
+            name[length++] = '_';
+        }
+        if (is_word(*p)) {
+            name[length++] = (char)toupper(c);
+        } else {
+            const char *punctuation = punctuation_name((char)c);
+            length += (size_t)(punctuation
+                                   ? snprintf(name + length, capacity - length, "%s", punctuation)
+                                   : snprintf(name + length, capacity - length, "X%02X", c));
+        }
+    }
+    name[length] = '\0';
+    if (name_taken(set, name)) {
+        char *base = name;
+        name = malloc(capacity + 8);
+        for (unsigned suffix = 2;; suffix++) {
+            snprintf(name, capacity + 8, "%s_%u", base, suffix);
+            if (!name_taken(set, name)) {
+                break;
+            }
+        }
+        free(base);
+    }
+    set->names = realloc(set->names, (set->count + 1) * sizeof(char *));
+    set->names[set->count++] = name;
+    return name;
+}
+
+static void print_c_string(const char *s) {
+    putchar('"');
+    for (; *s; s++) {
+        switch (*s) {
+            case '"': fputs("\\\"", stdout); break;
+            case '\\': fputs("\\\\", stdout); break;
+            case '\n': fputs("\\n", stdout); break;
+            case '\r': fputs("\\r", stdout); break;
+            case '\t': fputs("\\t", stdout); break;
+            default: putchar(*s);
+        }
+    }
+    putchar('"');
+}
+
+// ts_node_symbol() 只会返回可见的、并且是自己公开 id 的 symbol
+static bool is_public(const TSLanguage *language, TSSymbol symbol) {
+    return language->symbol_metadata[symbol].visible &&
+           language->public_symbol_map[symbol] == symbol;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && !freopen(argv[1], "w", stdout)) {
+        perror(argv[1]);
+        return 1;
+    }
+    const TSLanguage *language = tree_sitter_vim9();
+    uint32_t symbol_count = language->symbol_count + language->alias_count;
+    NameSet set = {0};
+    char **symbols = calloc(symbol_count, sizeof(char *));
+    for (TSSymbol i = 0; i < symbol_count; i++) {
+        if (is_public(language, i)) {
+            const char *prefix = language->symbol_metadata[i].named ? "TREE_SITTER_VIM9_SYM_"
+                                                                    : "TREE_SITTER_VIM9_ANON_";
+            symbols[i] = constant_name(&set, prefix, language->symbol_names[i]);
+        }
+    }
+    char **fields = calloc(language->field_count + 1, sizeof(char *));
+    for (TSFieldId i = 1; i <= language->field_count; i++) {
+        fields[i] = constant_name(&set, "TREE_SITTER_VIM9_FIELD_", language->field_names[i]);
+    }
+
+    printf("// Generated by tools/symbols/gen.c from src/parser.c; do not edit.\n"
+           "// Regenerate with `make symbols` (or the CMake `symbols` target) whenever\n"
+           "// src/parser.c is regenerated.\n"
+           "//\n"
+           "// The public symbol ids ts_node_symbol() returns, and the field ids, of the\n"
+           "// parser this header was generated from, so a consumer can dispatch with a\n"
+           "// switch instead of comparing ts_node_type() strings. The ids are only\n"
+           "// stable for one generated parser: check TREE_SITTER_VIM9_SYMBOL_COUNT and\n"
+           "// TREE_SITTER_VIM9_FIELD_COUNT against ts_language_symbol_count() and\n"
+           "// ts_language_field_count() when loading the language dynamically.\n"
+           "\n"
+           "#ifndef TREE_SITTER_VIM9_SYMBOLS_H_\n"
+           "#define TREE_SITTER_VIM9_SYMBOLS_H_\n"
+           "\n"
+           "#include <stdbool.h>\n"
+           "\n"
+           "#define TREE_SITTER_VIM9_LANGUAGE_VERSION %u\n"
+           "#define TREE_SITTER_VIM9_SYMBOL_COUNT %u\n"
+           "#define TREE_SITTER_VIM9_FIELD_COUNT %u\n"
+           "\n"
+           "enum {\n"
+           "    TREE_SITTER_VIM9_SYM_ERROR = 65535,  // \"ERROR\"\n",
+           language->abi_version, symbol_count, language->field_count);
+    for (TSSymbol i = 0; i < symbol_count; i++) {
+        if (symbols[i]) {
+            printf("    %s = %u,  // ", symbols[i], i);
+            print_c_string(language->symbol_names[i]);
+            putchar('\n');
+        }
+    }
+    printf("};\n");
+    if (language->field_count > 0) {
+        printf("\nenum {\n");
+        for (TSFieldId i = 1; i <= language->field_count; i++) {
+            printf("    %s = %u,\n", fields[i], i);
+        }
+        printf("};\n");
+    }
+
+    // X(constant, id, type, named)，给查表和测试用
+    printf("\n// X(constant, id, type, named) for every constant above except ERROR.\n"
+           "#define TREE_SITTER_VIM9_SYMBOL_LIST(X)");
+    for (TSSymbol i = 0; i < symbol_count; i++) {
+        if (symbols[i]) {
+            printf(" \\\n    X(%s, %u, ", symbols[i], i);
+            print_c_string(language->symbol_names[i]);
+            printf(", %s)", language->symbol_metadata[i].named ? "true" : "false");
+        }
+    }
+    printf("\n\n// X(constant, id, name)\n#define TREE_SITTER_VIM9_FIELD_LIST(X)");
+    for (TSFieldId i = 1; i <= language->field_count; i++) {
+        printf(" \\\n    X(%s, %u, ", fields[i], i);
+        print_c_string(language->field_names[i]);
+        putchar(')');
+    }
+    printf("\n\n#endif // TREE_SITTER_VIM9_SYMBOLS_H_\n");
+
+    for (size_t i = 0; i < set.count; i++) {
+        free(set.names[i]);
+    }
+    free(set.names);
+    free(symbols);
+    free(fields);
+    return 0;
+}